@@ -0,0 +1,291 @@
+#include <benchmark/benchmark.h>
+#include <ae/memory_block_initializer.h>
+#include <ae/memory_block.h>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cstdio>
+#endif
+
+// Модель обработчика запроса: множество мелких выделений, которые
+// освобождаются все вместе в конце запроса. При включённой опции
+// AE_LIBRARY_OPTION_RUNTIME_ALLOCATOR_INIT_STDLIB распределитель времени
+// выполнения ae опирается на malloc/free, поэтому это базовая линия
+// для специализированных распределителей.
+static void malloc_free_request_bench(benchmark::State &state) {
+  const auto count = static_cast<size_t>(state.range(0));
+  static const size_t sizes[] = {16, 24, 48, 64, 100, 256};
+  std::vector<void *> pointers(count);
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < count; ++i) {
+      pointers[i] = malloc(sizes[i % (sizeof(sizes) / sizeof(sizes[0]))]);
+      benchmark::DoNotOptimize(pointers[i]);
+    }
+    for (void *pointer : pointers) {
+      free(pointer);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(count));
+}
+BENCHMARK(malloc_free_request_bench)
+    ->ArgName("allocations")
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(10000);
+
+// Ёмкость канала передачи указателей между парой потоков (степень двойки).
+static const size_t ae_bench_handoff_capacity = 256;
+
+// Канал от потока, выделяющего объекты, к потоку, освобождающему их:
+// кольцо указателей, слоты которого адресуются через ae_memory_block_t
+// с element_size, равным размеру указателя.
+struct ae_bench_handoff {
+  ae_bench_handoff()
+      : slots_block(ae_memory_block_initializer(
+            slots, slots + ae_bench_handoff_capacity, sizeof(void *))) {}
+
+  void *&slot(size_t index) {
+    return *static_cast<void **>(ae_memory_block_at(
+        &slots_block, index & (ae_bench_handoff_capacity - 1), false));
+  }
+
+  void push(void *pointer) {
+    const size_t index = tail.load(std::memory_order_relaxed);
+    while (index - head.load(std::memory_order_acquire) ==
+           ae_bench_handoff_capacity) {
+      std::this_thread::yield();
+    }
+    slot(index) = pointer;
+    tail.store(index + 1, std::memory_order_release);
+  }
+
+  void *pop() {
+    const size_t index = head.load(std::memory_order_relaxed);
+    while (tail.load(std::memory_order_acquire) == index) {
+      std::this_thread::yield();
+    }
+    void *pointer = slot(index);
+    head.store(index + 1, std::memory_order_release);
+    return pointer;
+  }
+
+  alignas(64) std::atomic<size_t> head{0};
+  alignas(64) std::atomic<size_t> tail{0};
+  void *slots[ae_bench_handoff_capacity];
+  ae_memory_block_t slots_block;
+};
+
+// Каналы пар потоков текущего запуска; создаются потоком 0 до начала
+// замера и удаляются им после.
+static std::vector<std::unique_ptr<ae_bench_handoff>> ae_bench_handoffs;
+
+// Объекты выделяются в чётных потоках, передаются через канал и
+// освобождаются в нечётных, включая стоимость освобождения памяти,
+// выделенной другим потоком. Размеры берутся из `sizes`: один размер -
+// базовая линия для пула элементов фиксированного размера, смесь малых
+// классов - для распределителя с кэшами потоков.
+static void malloc_free_churn_bench(benchmark::State &state,
+                                    const std::vector<size_t> &sizes) {
+  const size_t batch = 64;
+
+  if (state.thread_index() == 0) {
+    ae_bench_handoffs.clear();
+    for (int pair = 0; pair < state.threads() / 2; ++pair) {
+      ae_bench_handoffs.emplace_back(new ae_bench_handoff());
+    }
+  }
+
+  const bool producer = state.thread_index() % 2 == 0;
+  for (auto _ : state) {
+    ae_bench_handoff &handoff = *ae_bench_handoffs[state.thread_index() / 2];
+    for (size_t i = 0; i < batch; ++i) {
+      if (producer) {
+        const size_t size =
+            sizes[(i * 7 + static_cast<size_t>(state.thread_index())) %
+                  sizes.size()];
+        void *pointer = malloc(size);
+        benchmark::DoNotOptimize(pointer);
+        handoff.push(pointer);
+      } else {
+        free(handoff.pop());
+      }
+    }
+  }
+  // Объект учитывается один раз - потоком, который его выделил.
+  state.SetItemsProcessed(producer ? static_cast<int64_t>(state.iterations()) *
+                                         static_cast<int64_t>(batch)
+                                   : 0);
+
+  if (state.thread_index() == 0) {
+    ae_bench_handoffs.clear();
+  }
+}
+BENCHMARK_CAPTURE(malloc_free_churn_bench, fixed_64, std::vector<size_t>{64})
+    ->ThreadRange(2, 32)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(malloc_free_churn_bench, fixed_256, std::vector<size_t>{256})
+    ->ThreadRange(2, 32)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(malloc_free_churn_bench, size_classes,
+                  std::vector<size_t>{8, 16, 32, 48, 64, 96, 128, 256, 512,
+                                      1024})
+    ->ThreadRange(2, 32)
+    ->UseRealTime();
+
+// Размеры выделений от 4 КиБ до 1 ГиБ.
+static void ae_bench_allocation_size(benchmark::internal::Benchmark *b) {
+  b->ArgName("size");
+  for (int64_t size = int64_t{4} << 10; size <= int64_t{1} << 30; size *= 16) {
+    b->Arg(size);
+  }
+  b->Arg(int64_t{1} << 30);
+}
+
+// Объём резидентной памяти процесса в байтах (0, если недоступен).
+static size_t ae_bench_resident_size() {
+#if defined(__linux__)
+  FILE *statm = fopen("/proc/self/statm", "r");
+  if (!statm) {
+    return 0;
+  }
+  unsigned long size = 0;
+  unsigned long resident = 0;
+  const int read = fscanf(statm, "%lu %lu", &size, &resident);
+  fclose(statm);
+  return read == 2 ? resident * static_cast<size_t>(sysconf(_SC_PAGESIZE))
+                   : 0;
+#else
+  return 0;
+#endif
+}
+
+// Размер страницы памяти, с шагом которого выполняется первое обращение.
+static size_t ae_bench_page_size() {
+#if defined(__linux__)
+  return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#else
+  return 4096;
+#endif
+}
+
+// Записывает по одному байту в каждую страницу блока, вызывая
+// выделение физических страниц при первом обращении.
+static void ae_bench_touch_pages(void *pointer, size_t size) {
+  if (!pointer) {
+    return;
+  }
+  auto *bytes = static_cast<volatile unsigned char *>(pointer);
+  const size_t page_size = ae_bench_page_size();
+  for (size_t offset = 0; offset < size; offset += page_size) {
+    bytes[offset] = 1;
+  }
+}
+
+// Прирост резидентной памяти при первом выделении, вне замера времени.
+// При `touch` перед замером выполняется запись в каждую страницу.
+template <typename Allocate, typename Release>
+static void ae_bench_report_rss_growth(benchmark::State &state, size_t size,
+                                       Allocate allocate, Release release,
+                                       bool touch) {
+  const size_t before = ae_bench_resident_size();
+  void *pointer = allocate(size);
+  benchmark::DoNotOptimize(pointer);
+  if (touch) {
+    ae_bench_touch_pages(pointer, size);
+  }
+  benchmark::ClobberMemory();
+  const size_t after = ae_bench_resident_size();
+  release(pointer, size);
+
+  state.counters["rss_growth"] = benchmark::Counter(
+      static_cast<double>(after > before ? after - before : 0),
+      benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+}
+
+// Цикл замера: выделение, при `touch` - запись в каждую страницу,
+// освобождение.
+template <typename Allocate, typename Release>
+static void ae_bench_allocation_loop(benchmark::State &state, Allocate allocate,
+                                     Release release, bool touch) {
+  const auto size = static_cast<size_t>(state.range(0));
+  ae_bench_report_rss_growth(state, size, allocate, release, touch);
+
+  for (auto _ : state) {
+    void *pointer = allocate(size);
+    benchmark::DoNotOptimize(pointer);
+    if (touch) {
+      ae_bench_touch_pages(pointer, size);
+    }
+    benchmark::ClobberMemory();
+    release(pointer, size);
+  }
+}
+
+// Выделение с явным заполнением нулями, как при включённой опции
+// AE_LIBRARY_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE.
+static void malloc_memset_zero_bench(benchmark::State &state) {
+  auto allocate = [](size_t n) {
+    // Указатель скрывается от компилятора, чтобы пара malloc+memset
+    // не была заменена на calloc.
+    void *pointer = malloc(n);
+    benchmark::DoNotOptimize(pointer);
+    if (pointer) {
+      memset(pointer, 0, n);
+    }
+    return pointer;
+  };
+  auto release = [](void *pointer, size_t) { free(pointer); };
+  ae_bench_allocation_loop(state, allocate, release, false);
+}
+BENCHMARK(malloc_memset_zero_bench)->Apply(ae_bench_allocation_size);
+
+// Выделение без заполнения нулями, как при выключенной опции.
+static void malloc_bench(benchmark::State &state) {
+  auto allocate = [](size_t n) { return malloc(n); };
+  auto release = [](void *pointer, size_t) { free(pointer); };
+  ae_bench_allocation_loop(state, allocate, release, false);
+}
+BENCHMARK(malloc_bench)->Apply(ae_bench_allocation_size);
+
+// Заполненная нулями память от calloc: для больших блоков нулевые
+// страницы поставляет система и явное заполнение не выполняется.
+// Вариант `touch` включает стоимость первого обращения к каждой странице.
+static void calloc_bench(benchmark::State &state, bool touch) {
+  auto allocate = [](size_t n) { return calloc(1, n); };
+  auto release = [](void *pointer, size_t) { free(pointer); };
+  ae_bench_allocation_loop(state, allocate, release, touch);
+}
+BENCHMARK_CAPTURE(calloc_bench, untouched, false)
+    ->Apply(ae_bench_allocation_size);
+BENCHMARK_CAPTURE(calloc_bench, touch, true)->Apply(ae_bench_allocation_size);
+
+#if defined(__linux__)
+// Анонимное отображение: нулевые страницы выделяются при первом обращении.
+static void mmap_anonymous_bench(benchmark::State &state, bool touch) {
+  auto allocate = [](size_t n) {
+    void *pointer = mmap(nullptr, n, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return pointer == MAP_FAILED ? nullptr : pointer;
+  };
+  auto release = [](void *pointer, size_t n) {
+    if (pointer) {
+      munmap(pointer, n);
+    }
+  };
+  ae_bench_allocation_loop(state, allocate, release, touch);
+}
+BENCHMARK_CAPTURE(mmap_anonymous_bench, untouched, false)
+    ->Apply(ae_bench_allocation_size);
+BENCHMARK_CAPTURE(mmap_anonymous_bench, touch, true)
+    ->Apply(ae_bench_allocation_size);
+#endif
@@ -0,0 +1,86 @@
+#ifndef AE_BENCH_COMMON_H
+#define AE_BENCH_COMMON_H
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Выравнивание, относительно которого задаётся смещение буферов.
+constexpr size_t ae_bench_alignment = 64;
+
+// Максимальный размер обрабатываемых данных (64 МиБ).
+constexpr int64_t ae_bench_max_size = int64_t{64} << 20;
+
+// Буфер, начало которого смещено на `misalignment` байт
+// относительно границы в `ae_bench_alignment` байт.
+class ae_bench_buffer {
+public:
+  ae_bench_buffer(size_t size, size_t misalignment)
+      : storage_(size + misalignment + ae_bench_alignment), size_(size) {
+    auto address = reinterpret_cast<uintptr_t>(storage_.data());
+    auto aligned = (address + ae_bench_alignment - 1) &
+                   ~static_cast<uintptr_t>(ae_bench_alignment - 1);
+    data_ = storage_.data() + (aligned - address) + misalignment;
+  }
+
+  ae_bench_buffer(ae_bench_buffer &&) = default;
+  ae_bench_buffer(const ae_bench_buffer &) = delete;
+  ae_bench_buffer &operator=(const ae_bench_buffer &) = delete;
+
+  unsigned char *begin() {
+    return data_;
+  }
+
+  unsigned char *end() {
+    return data_ + size_;
+  }
+
+  size_t size() const {
+    return size_;
+  }
+
+  // Заполняет буфер псевдослучайными байтами с фиксированным зерном.
+  void fill_random(unsigned seed) {
+    std::mt19937 engine(seed);
+    for (size_t i = 0; i < size_; ++i) {
+      data_[i] = static_cast<unsigned char>(engine());
+    }
+  }
+
+private:
+  std::vector<unsigned char> storage_;
+  unsigned char *data_;
+  size_t size_;
+};
+
+// Сообщает пропускную способность в байтах и в десятичных GB/s.
+inline void ae_bench_set_throughput(benchmark::State &state, size_t bytes) {
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(bytes));
+  state.counters["GB/s"] = benchmark::Counter(
+      static_cast<double>(bytes), benchmark::Counter::kIsIterationInvariantRate,
+      benchmark::Counter::kIs1000);
+}
+
+// Перебирает размеры от 1 байта до 64 МиБ (с шагом x4) и смещения 0-63.
+inline void ae_bench_size_and_misalignment(benchmark::internal::Benchmark *b) {
+  b->ArgNames({"size", "misalignment"});
+  for (int64_t size = 1; size <= ae_bench_max_size; size *= 4) {
+    for (int64_t misalignment : {0, 1, 7, 8, 15, 31, 32, 63}) {
+      b->Args({size, misalignment});
+    }
+  }
+}
+
+// Поиск символа, расположенного последним в буфере из `size` символов
+// (ae_char_t или ae_wchar_t).
+inline void ae_bench_find_char_size(benchmark::internal::Benchmark *b) {
+  b->ArgName("size");
+  for (int64_t size : {1, 7, 16, 31, 64, 127, 256, 1024, 4096, 65536}) {
+    b->Arg(size);
+  }
+}
+
+#endif // AE_BENCH_COMMON_H
@@ -0,0 +1,119 @@
+#include <benchmark/benchmark.h>
+#include <ae/memory_range_initializer.h>
+#include <ae/memory_range.h>
+#include <ae/memory_raw.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Хеш ключа-диапазона через std::hash для std::string_view.
+struct ae_bench_range_hash {
+  size_t operator()(const ae_memory_range_t &key) const {
+    return std::hash<std::string_view>()(std::string_view(
+        static_cast<const char *>(ae_memory_range_get_begin(&key)),
+        ae_memory_range_size(&key)));
+  }
+};
+
+// Равенство ключей-диапазонов через ae_memory_raw_compare.
+// Сравнение выполняется только по общей длине, поэтому
+// размеры проверяются отдельно.
+struct ae_bench_range_equal {
+  bool operator()(const ae_memory_range_t &lhs,
+                  const ae_memory_range_t &rhs) const {
+    return ae_memory_range_size(&lhs) == ae_memory_range_size(&rhs) &&
+           ae_memory_raw_compare(ae_memory_range_get_begin(&lhs),
+                                 ae_memory_range_get_end(&lhs),
+                                 ae_memory_range_get_begin(&rhs),
+                                 ae_memory_range_get_end(&rhs)) == nullptr;
+  }
+};
+
+using ae_bench_range_map =
+    std::unordered_map<ae_memory_range_t, uint64_t, ae_bench_range_hash,
+                       ae_bench_range_equal>;
+
+// Набор ключей вида "session:<номер>", хранящихся в одном буфере.
+class ae_bench_keys {
+public:
+  explicit ae_bench_keys(size_t count) {
+    char key[32];
+    std::vector<size_t> offsets;
+
+    for (size_t i = 0; i < count; ++i) {
+      const int length = snprintf(key, sizeof(key), "session:%zu", i);
+      offsets.push_back(storage_.size());
+      storage_.insert(storage_.end(), key, key + length);
+    }
+    offsets.push_back(storage_.size());
+
+    for (size_t i = 0; i < count; ++i) {
+      ranges_.push_back(ae_memory_range_initializer(
+          &storage_[offsets[i]], storage_.data() + offsets[i + 1]));
+    }
+  }
+
+  const std::vector<ae_memory_range_t> &ranges() const {
+    return ranges_;
+  }
+
+private:
+  std::vector<char> storage_;
+  std::vector<ae_memory_range_t> ranges_;
+};
+
+// Поиск существующих ключей в случайном порядке в узловой
+// std::unordered_map - базовая линия для плоской таблицы.
+static void unordered_map_range_lookup_bench(benchmark::State &state) {
+  const auto count = static_cast<size_t>(state.range(0));
+  const ae_bench_keys keys(count);
+
+  ae_bench_range_map map;
+  map.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    map.emplace(keys.ranges()[i], i);
+  }
+
+  std::vector<ae_memory_range_t> lookups = keys.ranges();
+  std::shuffle(lookups.begin(), lookups.end(), std::mt19937_64(1));
+
+  for (auto _ : state) {
+    uint64_t sum = 0;
+    for (const ae_memory_range_t &key : lookups) {
+      sum += map.find(key)->second;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(count));
+}
+BENCHMARK(unordered_map_range_lookup_bench)
+    ->ArgName("keys")
+    ->RangeMultiplier(64)
+    ->Range(1024, 1 << 22)
+    ->Unit(benchmark::kMicrosecond);
+
+// Вставка ключей в пустую std::unordered_map без предварительного reserve.
+static void unordered_map_range_insert_bench(benchmark::State &state) {
+  const auto count = static_cast<size_t>(state.range(0));
+  const ae_bench_keys keys(count);
+
+  for (auto _ : state) {
+    ae_bench_range_map map;
+    for (size_t i = 0; i < count; ++i) {
+      map.emplace(keys.ranges()[i], i);
+    }
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(count));
+}
+BENCHMARK(unordered_map_range_insert_bench)
+    ->ArgName("keys")
+    ->RangeMultiplier(64)
+    ->Range(1024, 1 << 22)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,428 @@
+#include <benchmark/benchmark.h>
+#include <ae/memory_block_initializer.h>
+#include <ae/memory_range_initializer.h>
+#include <ae/memory_block.h>
+#include <ae/memory_range.h>
+#include <ae/memory_raw.h>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cstdio>
+#endif
+
+#include "common.h"
+
+// Количество элементов в блоке при поэлементном обходе.
+static const size_t ae_bench_element_count = size_t{1} << 20;
+
+// Обход блока через проверяющий ae_memory_block_at.
+static void ae_memory_block_at_iterate_bench(benchmark::State &state) {
+  std::vector<uint32_t> data(ae_bench_element_count);
+  std::iota(data.begin(), data.end(), 0);
+  const ae_memory_block_t block = ae_memory_block_initializer(
+      data.data(), data.data() + data.size(), sizeof(uint32_t));
+
+  for (auto _ : state) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < ae_bench_element_count; ++i) {
+      sum += *static_cast<const uint32_t *>(
+          ae_memory_block_at(&block, i, false));
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(ae_bench_element_count));
+}
+BENCHMARK(ae_memory_block_at_iterate_bench);
+
+// Эталон для ae_memory_block_at: тот же блок uint32_t, проверка индекса
+// и адрес элемента вычисляются в цикле. DoNotOptimize на адресе запрещает
+// векторизацию, чтобы сравнение оставалось поэлементным.
+static void inline_block_at_iterate_bench(benchmark::State &state) {
+  std::vector<uint32_t> data(ae_bench_element_count);
+  std::iota(data.begin(), data.end(), 0);
+  const ae_memory_block_t block = ae_memory_block_initializer(
+      data.data(), data.data() + data.size(), sizeof(uint32_t));
+  const auto *begin =
+      static_cast<const unsigned char *>(ae_memory_block_front(&block));
+  const size_t element_size = ae_memory_block_get_element_size(&block);
+  const size_t count = ae_memory_block_size(&block);
+
+  for (auto _ : state) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < ae_bench_element_count; ++i) {
+      if (i >= count) {
+        break;
+      }
+      const unsigned char *element = begin + i * element_size;
+      benchmark::DoNotOptimize(element);
+      sum += *reinterpret_cast<const uint32_t *>(element);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(ae_bench_element_count));
+}
+BENCHMARK(inline_block_at_iterate_bench);
+
+// Обход блока с проверкой индекса через ae_memory_block_has_index.
+static void ae_memory_block_has_index_iterate_bench(benchmark::State &state) {
+  std::vector<uint32_t> data(ae_bench_element_count);
+  std::iota(data.begin(), data.end(), 0);
+  const ae_memory_block_t block = ae_memory_block_initializer(
+      data.data(), data.data() + data.size(), sizeof(uint32_t));
+  const auto *begin =
+      static_cast<const unsigned char *>(ae_memory_block_front(&block));
+  const size_t element_size = ae_memory_block_get_element_size(&block);
+
+  for (auto _ : state) {
+    uint64_t sum = 0;
+    for (size_t i = 0; ae_memory_block_has_index(&block, i); ++i) {
+      sum += *reinterpret_cast<const uint32_t *>(begin + i * element_size);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(ae_bench_element_count));
+}
+BENCHMARK(ae_memory_block_has_index_iterate_bench);
+
+// Эталон для ae_memory_block_has_index: граница цикла - размер того же
+// блока, полученный один раз.
+static void inline_block_has_index_iterate_bench(benchmark::State &state) {
+  std::vector<uint32_t> data(ae_bench_element_count);
+  std::iota(data.begin(), data.end(), 0);
+  const ae_memory_block_t block = ae_memory_block_initializer(
+      data.data(), data.data() + data.size(), sizeof(uint32_t));
+  const auto *begin =
+      static_cast<const unsigned char *>(ae_memory_block_front(&block));
+  const size_t element_size = ae_memory_block_get_element_size(&block);
+  const size_t count = ae_memory_block_size(&block);
+
+  for (auto _ : state) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < count; ++i) {
+      const unsigned char *element = begin + i * element_size;
+      benchmark::DoNotOptimize(element);
+      sum += *reinterpret_cast<const uint32_t *>(element);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(ae_bench_element_count));
+}
+BENCHMARK(inline_block_has_index_iterate_bench);
+
+// Обход диапазона через проверяющий ae_memory_range_at.
+static void ae_memory_range_at_iterate_bench(benchmark::State &state) {
+  std::vector<uint8_t> data(ae_bench_element_count);
+  std::iota(data.begin(), data.end(), 0);
+  const ae_memory_range_t range =
+      ae_memory_range_initializer(data.data(), data.data() + data.size());
+
+  for (auto _ : state) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < ae_bench_element_count; ++i) {
+      sum +=
+          *static_cast<const uint8_t *>(ae_memory_range_at(&range, i, false));
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(ae_bench_element_count));
+}
+BENCHMARK(ae_memory_range_at_iterate_bench);
+
+// Эталон для ae_memory_range_at: тот же диапазон uint8_t, проверка индекса
+// и адрес элемента вычисляются в цикле.
+static void inline_range_at_iterate_bench(benchmark::State &state) {
+  std::vector<uint8_t> data(ae_bench_element_count);
+  std::iota(data.begin(), data.end(), 0);
+  const ae_memory_range_t range =
+      ae_memory_range_initializer(data.data(), data.data() + data.size());
+  const auto *begin =
+      static_cast<const uint8_t *>(ae_memory_range_get_begin(&range));
+  const size_t size = ae_memory_range_size(&range);
+
+  for (auto _ : state) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < ae_bench_element_count; ++i) {
+      if (i >= size) {
+        break;
+      }
+      const uint8_t *element = begin + i;
+      benchmark::DoNotOptimize(element);
+      sum += *element;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(ae_bench_element_count));
+}
+BENCHMARK(inline_range_at_iterate_bench);
+
+// Обход диапазона через проверяющий ae_memory_range_at_from_begin.
+static void ae_memory_range_at_from_begin_iterate_bench(
+    benchmark::State &state) {
+  std::vector<uint8_t> data(ae_bench_element_count);
+  std::iota(data.begin(), data.end(), 0);
+  const ae_memory_range_t range =
+      ae_memory_range_initializer(data.data(), data.data() + data.size());
+
+  for (auto _ : state) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < ae_bench_element_count; ++i) {
+      sum += *static_cast<const uint8_t *>(
+          ae_memory_range_at_from_begin(&range, i));
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(ae_bench_element_count));
+}
+BENCHMARK(ae_memory_range_at_from_begin_iterate_bench);
+
+// Эталон для ae_memory_range_at_from_begin: прямой порядок обхода,
+// как у ae_memory_range_at без флага обратного направления.
+static void inline_range_at_from_begin_iterate_bench(benchmark::State &state) {
+  std::vector<uint8_t> data(ae_bench_element_count);
+  std::iota(data.begin(), data.end(), 0);
+  const ae_memory_range_t range =
+      ae_memory_range_initializer(data.data(), data.data() + data.size());
+  const auto *begin =
+      static_cast<const uint8_t *>(ae_memory_range_get_begin(&range));
+  const size_t size = ae_memory_range_size(&range);
+
+  for (auto _ : state) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < ae_bench_element_count; ++i) {
+      if (i >= size) {
+        break;
+      }
+      const uint8_t *element = begin + i;
+      benchmark::DoNotOptimize(element);
+      sum += *element;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(ae_bench_element_count));
+}
+BENCHMARK(inline_range_at_from_begin_iterate_bench);
+
+#if defined(__linux__)
+// Размер огромной страницы x86-64, по которому выравнивается отображение.
+static const size_t ae_bench_huge_page_size = size_t{2} << 20;
+
+// Объём анонимной памяти процесса на огромных страницах, в байтах.
+static size_t ae_bench_anon_huge_pages() {
+  FILE *smaps = fopen("/proc/self/smaps_rollup", "r");
+  if (!smaps) {
+    return 0;
+  }
+  char line[256];
+  unsigned long kilobytes = 0;
+  while (fgets(line, sizeof(line), smaps)) {
+    if (sscanf(line, "AnonHugePages: %lu kB", &kilobytes) == 1) {
+      break;
+    }
+  }
+  fclose(smaps);
+  return static_cast<size_t>(kilobytes) << 10;
+}
+
+// Случайный доступ через ae_memory_block_at к блоку размером `size`,
+// размещённому на страницах 4 КиБ (huge == 0) или на прозрачных огромных
+// страницах 2 МиБ (huge == 1). Если огромные страницы недоступны, блок
+// остаётся на обычных страницах, что видно по счётчику huge_pages.
+static void ae_memory_block_at_random_access_bench(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  const bool huge = state.range(1) != 0;
+
+  // Заполнение блока больше физической памяти привело бы к завершению
+  // всего процесса по OOM, поэтому такой размер пропускается.
+  const auto physical_memory = static_cast<size_t>(sysconf(_SC_PHYS_PAGES)) *
+                               static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  if (size >= physical_memory) {
+    state.SkipWithError("not enough physical memory");
+    return;
+  }
+
+  const size_t mapped_size = size + ae_bench_huge_page_size;
+  void *mapping = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (mapping == MAP_FAILED) {
+    state.SkipWithError("mmap failed");
+    return;
+  }
+
+  const auto address = reinterpret_cast<uintptr_t>(mapping);
+  auto *data = reinterpret_cast<unsigned char *>(
+      (address + ae_bench_huge_page_size - 1) &
+      ~static_cast<uintptr_t>(ae_bench_huge_page_size - 1));
+  madvise(data, size, huge ? MADV_HUGEPAGE : MADV_NOHUGEPAGE);
+
+  const size_t huge_pages_before = ae_bench_anon_huge_pages();
+  memset(data, 1, size);
+  const size_t huge_pages_after = ae_bench_anon_huge_pages();
+
+  const ae_memory_block_t block =
+      ae_memory_block_initializer(data, data + size, sizeof(uint64_t));
+  const size_t count = size / sizeof(uint64_t);
+  uint64_t state_value = 0x9E3779B97F4A7C15ull;
+  const size_t accesses = 1 << 16;
+
+  for (auto _ : state) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < accesses; ++i) {
+      // xorshift64: дешёвый генератор случайных индексов.
+      state_value ^= state_value << 13;
+      state_value ^= state_value >> 7;
+      state_value ^= state_value << 17;
+      sum += *static_cast<const uint64_t *>(
+          ae_memory_block_at(&block, state_value % count, false));
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  munmap(mapping, mapped_size);
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(accesses));
+  state.counters["huge_pages"] = benchmark::Counter(
+      static_cast<double>(huge_pages_after > huge_pages_before
+                              ? huge_pages_after - huge_pages_before
+                              : 0),
+      benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+  state.SetLabel(huge ? "2M" : "4K");
+}
+BENCHMARK(ae_memory_block_at_random_access_bench)
+    ->ArgNames({"size", "huge"})
+    ->Args({int64_t{256} << 20, 0})
+    ->Args({int64_t{256} << 20, 1})
+    ->Args({int64_t{4} << 30, 0})
+    ->Args({int64_t{4} << 30, 1})
+    ->Unit(benchmark::kMicrosecond);
+#endif
+
+// Добавление элементов в std::vector без предварительного reserve.
+static void std_vector_push_back_bench(benchmark::State &state) {
+  const auto count = static_cast<size_t>(state.range(0));
+
+  for (auto _ : state) {
+    std::vector<uint64_t> data;
+    for (uint64_t i = 0; i < count; ++i) {
+      data.push_back(i);
+    }
+    benchmark::DoNotOptimize(data.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(count));
+}
+BENCHMARK(std_vector_push_back_bench)
+    ->RangeMultiplier(64)
+    ->Range(1024, 1 << 22);
+
+// Добавление элементов в блок с геометрическим ростом через realloc.
+// Счётчик in_place - доля расширений, выполненных без перемещения данных.
+static void ae_memory_block_realloc_push_back_bench(benchmark::State &state) {
+  const auto count = static_cast<size_t>(state.range(0));
+  const size_t element_size = sizeof(uint64_t);
+  size_t grows = 0;
+  size_t in_place = 0;
+
+  for (auto _ : state) {
+    uint8_t *begin = nullptr;
+    size_t capacity = 0;
+    bool failed = false;
+
+    for (uint64_t i = 0; i < count; ++i) {
+      if (i == capacity) {
+        capacity = capacity ? capacity * 2 : 8;
+        // Адрес сохраняется до вызова: после realloc старый указатель
+        // может быть недействительным.
+        const auto previous = reinterpret_cast<uintptr_t>(begin);
+        auto *grown =
+            static_cast<uint8_t *>(realloc(begin, capacity * element_size));
+        if (!grown) {
+          failed = true;
+          break;
+        }
+        in_place += reinterpret_cast<uintptr_t>(grown) == previous;
+        ++grows;
+        begin = grown;
+      }
+
+      const ae_memory_block_t block = ae_memory_block_initializer(
+          begin, begin + (i + 1) * element_size, element_size);
+      memcpy(ae_memory_block_back(&block), &i, element_size);
+    }
+    benchmark::DoNotOptimize(begin);
+    free(begin);
+
+    if (failed) {
+      state.SkipWithError("realloc failed");
+      break;
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(count));
+  state.counters["in_place"] =
+      grows ? static_cast<double>(in_place) / static_cast<double>(grows) : 0;
+}
+BENCHMARK(ae_memory_block_realloc_push_back_bench)
+    ->RangeMultiplier(64)
+    ->Range(1024, 1 << 22);
+
+// Добавление элементов в блок с геометрическим ростом, при котором
+// каждое расширение выделяет новую память и переносит элементы через
+// ae_memory_raw_move.
+static void ae_memory_block_move_push_back_bench(benchmark::State &state) {
+  const auto count = static_cast<size_t>(state.range(0));
+  const size_t element_size = sizeof(uint64_t);
+
+  for (auto _ : state) {
+    uint8_t *begin = nullptr;
+    size_t capacity = 0;
+    bool failed = false;
+
+    for (uint64_t i = 0; i < count; ++i) {
+      if (i == capacity) {
+        capacity = capacity ? capacity * 2 : 8;
+        auto *grown = static_cast<uint8_t *>(malloc(capacity * element_size));
+        if (!grown) {
+          failed = true;
+          break;
+        }
+        if (begin) {
+          ae_memory_raw_move(grown, grown + i * element_size, begin,
+                             begin + i * element_size);
+        }
+        free(begin);
+        begin = grown;
+      }
+
+      const ae_memory_block_t block = ae_memory_block_initializer(
+          begin, begin + (i + 1) * element_size, element_size);
+      memcpy(ae_memory_block_back(&block), &i, element_size);
+    }
+    benchmark::DoNotOptimize(begin);
+    free(begin);
+
+    if (failed) {
+      state.SkipWithError("malloc failed");
+      break;
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(count));
+}
+BENCHMARK(ae_memory_block_move_push_back_bench)
+    ->RangeMultiplier(64)
+    ->Range(1024, 1 << 22);
@@ -0,0 +1,131 @@
+#include <benchmark/benchmark.h>
+#include <ae/memory_range_initializer.h>
+#include <ae/memory_range.h>
+#include <ae/memory_raw.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "common.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Размер файла, по которому выполняется поиск.
+static const size_t ae_bench_file_size = size_t{64} << 20;
+
+// Временный файл с псевдослучайным содержимым в каталоге TMPDIR
+// (по умолчанию /tmp); удаляется при закрытии.
+static int ae_bench_create_file(size_t size) {
+  const char *directory = getenv("TMPDIR");
+  std::string path = directory && *directory ? directory : "/tmp";
+  path += "/ae_bench_file_XXXXXX";
+  const int fd = mkstemp(&path[0]);
+  if (fd < 0) {
+    return -1;
+  }
+  unlink(path.c_str());
+
+  ae_bench_buffer content(size, 0);
+  content.fill_random(1);
+  if (write(fd, content.begin(), size) != static_cast<ssize_t>(size)) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+// Игла, которой нет в файле: поиск проходит его целиком.
+static const unsigned char ae_bench_file_needle[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+
+// Поиск по отображению файла с подсказкой madvise, без копирования данных.
+// hint: 0 - MADV_NORMAL, 1 - MADV_SEQUENTIAL, 2 - MADV_RANDOM,
+// 3 - MADV_WILLNEED.
+static void ae_memory_raw_find_mmap_bench(benchmark::State &state) {
+  const int fd = ae_bench_create_file(ae_bench_file_size);
+  if (fd < 0) {
+    state.SkipWithError("cannot create file");
+    return;
+  }
+
+  static const int advice[] = {MADV_NORMAL, MADV_SEQUENTIAL, MADV_RANDOM,
+                               MADV_WILLNEED};
+  const int hint = advice[state.range(0)];
+
+  for (auto _ : state) {
+    void *data =
+        mmap(nullptr, ae_bench_file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+      state.SkipWithError("mmap failed");
+      break;
+    }
+    madvise(data, ae_bench_file_size, hint);
+
+    const ae_memory_range_t range = ae_memory_range_initializer(
+        data, static_cast<unsigned char *>(data) + ae_bench_file_size);
+    const void *result = ae_memory_raw_find(
+        ae_memory_range_get_begin(&range), ae_memory_range_get_end(&range),
+        ae_bench_file_needle,
+        ae_bench_file_needle + sizeof(ae_bench_file_needle));
+    benchmark::DoNotOptimize(result);
+
+    munmap(data, ae_bench_file_size);
+  }
+  close(fd);
+  ae_bench_set_throughput(state, ae_bench_file_size);
+}
+BENCHMARK(ae_memory_raw_find_mmap_bench)
+    ->ArgName("hint")
+    ->DenseRange(0, 3)
+    ->Unit(benchmark::kMillisecond);
+
+// Поиск по тому же файлу после чтения блоками через read() в буфер.
+static void ae_memory_raw_find_read_bench(benchmark::State &state) {
+  const int fd = ae_bench_create_file(ae_bench_file_size);
+  if (fd < 0) {
+    state.SkipWithError("cannot create file");
+    return;
+  }
+
+  const auto chunk_size = static_cast<size_t>(state.range(0));
+  const size_t overlap = sizeof(ae_bench_file_needle) - 1;
+  ae_bench_buffer buffer(chunk_size + overlap, 0);
+
+  for (auto _ : state) {
+    // Хвост предыдущего блока сохраняется, чтобы не пропустить
+    // вхождение на границе блоков.
+    size_t kept = 0;
+    off_t offset = 0;
+    const void *result = nullptr;
+
+    while (!result) {
+      const ssize_t read_size =
+          pread(fd, buffer.begin() + kept, chunk_size, offset);
+      if (read_size <= 0) {
+        break;
+      }
+      offset += read_size;
+
+      unsigned char *end = buffer.begin() + kept + read_size;
+      result = ae_memory_raw_find(
+          buffer.begin(), end, ae_bench_file_needle,
+          ae_bench_file_needle + sizeof(ae_bench_file_needle));
+
+      kept = std::min<size_t>(overlap, end - buffer.begin());
+      memmove(buffer.begin(), end - kept, kept);
+    }
+    benchmark::DoNotOptimize(result);
+  }
+  close(fd);
+  ae_bench_set_throughput(state, ae_bench_file_size);
+}
+BENCHMARK(ae_memory_raw_find_read_bench)
+    ->ArgName("chunk")
+    ->Arg(64 << 10)
+    ->Arg(1 << 20)
+    ->Unit(benchmark::kMillisecond);
+#endif
@@ -0,0 +1,337 @@
+#include <benchmark/benchmark.h>
+#include <ae/memory_range_initializer.h>
+#include <ae/memory_range.h>
+#include <ae/memory_raw.h>
+#include <algorithm>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "common.h"
+
+// Поиск набора шаблонов в одном диапазоне отдельным проходом
+// ae_memory_raw_find на каждый шаблон, с перечислением всех вхождений.
+static void ae_memory_range_find_each_pattern_bench(benchmark::State &state) {
+  const auto pattern_count = static_cast<size_t>(state.range(0));
+  const size_t pattern_size = 8;
+  const size_t size = size_t{1} << 20;
+
+  ae_bench_buffer haystack(size, 0);
+  haystack.fill_random(1);
+  ae_bench_buffer patterns(pattern_count * pattern_size, 0);
+  patterns.fill_random(2);
+
+  // Каждый шаблон встречается в диапазоне ровно один раз.
+  for (size_t i = 0; i < pattern_count; ++i) {
+    const size_t offset = (i * 7919 * pattern_size) % (size - pattern_size);
+    std::copy_n(patterns.begin() + i * pattern_size, pattern_size,
+                haystack.begin() + offset);
+  }
+
+  const ae_memory_range_t range =
+      ae_memory_range_initializer(haystack.begin(), haystack.end());
+  size_t matches = 0;
+
+  for (auto _ : state) {
+    matches = 0;
+    for (size_t i = 0; i < pattern_count; ++i) {
+      const unsigned char *pattern = patterns.begin() + i * pattern_size;
+      const auto *begin =
+          static_cast<const unsigned char *>(ae_memory_range_get_begin(&range));
+      const void *end = ae_memory_range_get_end(&range);
+
+      while (const void *found = ae_memory_raw_find(begin, end, pattern,
+                                                    pattern + pattern_size)) {
+        begin = static_cast<const unsigned char *>(found) + 1;
+        ++matches;
+      }
+    }
+    benchmark::DoNotOptimize(matches);
+  }
+  state.counters["matches"] = static_cast<double>(matches);
+  ae_bench_set_throughput(state, size);
+}
+BENCHMARK(ae_memory_range_find_each_pattern_bench)
+    ->ArgName("patterns")
+    ->Arg(1)
+    ->Arg(8)
+    ->Arg(64)
+    ->Arg(512);
+
+// Фрагменты смешанных размеров, описанные массивом ae_memory_range_t
+// и расположенные вразброс в одном буфере.
+class ae_bench_fragments {
+public:
+  explicit ae_bench_fragments(size_t count) : storage_(count * 4096, 0) {
+    static const size_t sizes[] = {8, 24, 64, 200, 512, 1500};
+    storage_.fill_random(1);
+
+    for (size_t i = 0; i < count; ++i) {
+      unsigned char *begin = storage_.begin() + i * 4096 + (i * 13) % 64;
+      const size_t size = sizes[i % (sizeof(sizes) / sizeof(sizes[0]))];
+      ranges_.push_back(ae_memory_range_initializer(begin, begin + size));
+      total_size_ += size;
+    }
+  }
+
+  const std::vector<ae_memory_range_t> &ranges() const {
+    return ranges_;
+  }
+
+  size_t total_size() const {
+    return total_size_;
+  }
+
+private:
+  ae_bench_buffer storage_;
+  std::vector<ae_memory_range_t> ranges_;
+  size_t total_size_ = 0;
+};
+
+static void ae_bench_fragment_count(benchmark::internal::Benchmark *b) {
+  b->ArgName("fragments");
+  for (int64_t count : {1, 4, 10, 16, 50, 64}) {
+    b->Arg(count);
+  }
+}
+
+// Сборка сообщения: один вызов ae_memory_raw_copy на каждый фрагмент.
+static void ae_memory_range_gather_by_copy_bench(benchmark::State &state) {
+  const ae_bench_fragments fragments(static_cast<size_t>(state.range(0)));
+  ae_bench_buffer message(fragments.total_size(), 0);
+
+  for (auto _ : state) {
+    unsigned char *dst = message.begin();
+    for (const ae_memory_range_t &range : fragments.ranges()) {
+      const auto *src_begin =
+          static_cast<const unsigned char *>(ae_memory_range_get_begin(&range));
+      const auto *src_end =
+          static_cast<const unsigned char *>(ae_memory_range_get_end(&range));
+      dst = static_cast<unsigned char *>(ae_memory_raw_copy(
+          dst, dst + (src_end - src_begin), src_begin, src_end));
+    }
+    benchmark::DoNotOptimize(dst);
+    benchmark::ClobberMemory();
+  }
+  ae_bench_set_throughput(state, fragments.total_size());
+}
+BENCHMARK(ae_memory_range_gather_by_copy_bench)->Apply(ae_bench_fragment_count);
+
+// Разбор сообщения: один вызов ae_memory_raw_copy на каждый фрагмент.
+static void ae_memory_range_scatter_by_copy_bench(benchmark::State &state) {
+  const ae_bench_fragments fragments(static_cast<size_t>(state.range(0)));
+  ae_bench_buffer message(fragments.total_size(), 0);
+  message.fill_random(2);
+
+  for (auto _ : state) {
+    const unsigned char *src = message.begin();
+    for (const ae_memory_range_t &range : fragments.ranges()) {
+      auto *dst_begin =
+          static_cast<unsigned char *>(ae_memory_range_get_begin(&range));
+      auto *dst_end =
+          static_cast<unsigned char *>(ae_memory_range_get_end(&range));
+      ae_memory_raw_copy(dst_begin, dst_end, src, src + (dst_end - dst_begin));
+      src += dst_end - dst_begin;
+    }
+    benchmark::DoNotOptimize(src);
+    benchmark::ClobberMemory();
+  }
+  ae_bench_set_throughput(state, fragments.total_size());
+}
+BENCHMARK(ae_memory_range_scatter_by_copy_bench)
+    ->Apply(ae_bench_fragment_count);
+
+// Количество диапазонов, перебираемых при замере накладных расходов вызова.
+static const size_t ae_bench_range_count = 1024;
+
+// Диапазоны разной длины внутри одного буфера. Эталонные бенчмарки
+// читают поля тех же структур, что и вызовы функций библиотеки.
+class ae_bench_ranges {
+public:
+  ae_bench_ranges() : storage_(ae_bench_range_count * 2, 0) {
+    for (size_t i = 0; i < ae_bench_range_count; ++i) {
+      unsigned char *begin = storage_.begin() + i;
+      unsigned char *end = begin + i % 7;
+      ranges_.push_back(ae_memory_range_initializer(begin, end));
+    }
+  }
+
+  const std::vector<ae_memory_range_t> &ranges() const {
+    return ranges_;
+  }
+
+private:
+  ae_bench_buffer storage_;
+  std::vector<ae_memory_range_t> ranges_;
+};
+
+static void ae_memory_range_get_begin_end_bench(benchmark::State &state) {
+  const ae_bench_ranges ranges;
+
+  for (auto _ : state) {
+    uintptr_t sum = 0;
+    for (const ae_memory_range_t &range : ranges.ranges()) {
+      sum += reinterpret_cast<uintptr_t>(ae_memory_range_get_begin(&range));
+      sum += reinterpret_cast<uintptr_t>(ae_memory_range_get_end(&range));
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(ae_bench_range_count));
+}
+BENCHMARK(ae_memory_range_get_begin_end_bench);
+
+static void ae_memory_range_diff_bench(benchmark::State &state) {
+  const ae_bench_ranges ranges;
+
+  for (auto _ : state) {
+    ae_ptrdiff_t sum = 0;
+    for (const ae_memory_range_t &range : ranges.ranges()) {
+      sum += ae_memory_range_diff(&range);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(ae_bench_range_count));
+}
+BENCHMARK(ae_memory_range_diff_bench);
+
+static void ae_memory_range_size_bench(benchmark::State &state) {
+  const ae_bench_ranges ranges;
+
+  for (auto _ : state) {
+    ae_usize_t sum = 0;
+    for (const ae_memory_range_t &range : ranges.ranges()) {
+      sum += ae_memory_range_size(&range);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(ae_bench_range_count));
+}
+BENCHMARK(ae_memory_range_size_bench);
+
+static void ae_memory_range_is_empty_bench(benchmark::State &state) {
+  const ae_bench_ranges ranges;
+
+  for (auto _ : state) {
+    size_t count = 0;
+    for (const ae_memory_range_t &range : ranges.ranges()) {
+      count += ae_memory_range_is_empty(&range) ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(ae_bench_range_count));
+}
+BENCHMARK(ae_memory_range_is_empty_bench);
+
+// Эталоны: те же вычисления по полям диапазона, встроенные в цикл.
+static void inline_range_get_begin_end_bench(benchmark::State &state) {
+  const ae_bench_ranges ranges;
+
+  for (auto _ : state) {
+    uintptr_t sum = 0;
+    for (const ae_memory_range_t &range : ranges.ranges()) {
+      sum += reinterpret_cast<uintptr_t>(range.begin);
+      sum += reinterpret_cast<uintptr_t>(range.end);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(ae_bench_range_count));
+}
+BENCHMARK(inline_range_get_begin_end_bench);
+
+static void inline_range_diff_bench(benchmark::State &state) {
+  const ae_bench_ranges ranges;
+
+  for (auto _ : state) {
+    ae_ptrdiff_t sum = 0;
+    for (const ae_memory_range_t &range : ranges.ranges()) {
+      sum += static_cast<const unsigned char *>(range.end) -
+             static_cast<const unsigned char *>(range.begin);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(ae_bench_range_count));
+}
+BENCHMARK(inline_range_diff_bench);
+
+static void inline_range_size_bench(benchmark::State &state) {
+  const ae_bench_ranges ranges;
+
+  for (auto _ : state) {
+    size_t sum = 0;
+    for (const ae_memory_range_t &range : ranges.ranges()) {
+      const auto *begin = static_cast<const unsigned char *>(range.begin);
+      const auto *end = static_cast<const unsigned char *>(range.end);
+      sum += end > begin ? static_cast<size_t>(end - begin) : 0;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(ae_bench_range_count));
+}
+BENCHMARK(inline_range_size_bench);
+
+static void inline_range_is_empty_bench(benchmark::State &state) {
+  const ae_bench_ranges ranges;
+
+  for (auto _ : state) {
+    size_t count = 0;
+    for (const ae_memory_range_t &range : ranges.ranges()) {
+      const auto *begin = static_cast<const unsigned char *>(range.begin);
+      const auto *end = static_cast<const unsigned char *>(range.end);
+      count += end > begin ? 0 : 1;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(ae_bench_range_count));
+}
+BENCHMARK(inline_range_is_empty_bench);
+
+// Хеширование диапазона через std::hash для std::string_view -
+// базовая линия для векторизованного хеша диапазонов.
+static void std_hash_range_bench(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  ae_bench_buffer buffer(size, 0);
+  buffer.fill_random(1);
+  const ae_memory_range_t range =
+      ae_memory_range_initializer(buffer.begin(), buffer.end());
+
+  for (auto _ : state) {
+    const size_t hash = std::hash<std::string_view>()(std::string_view(
+        static_cast<const char *>(ae_memory_range_get_begin(&range)),
+        ae_memory_range_size(&range)));
+    benchmark::DoNotOptimize(hash);
+  }
+  ae_bench_set_throughput(state, size);
+}
+BENCHMARK(std_hash_range_bench)->RangeMultiplier(4)->Range(8, 1 << 20);
+
+// Побайтовый FNV-1a по диапазону - типичный самописный хеш.
+static void fnv1a_range_bench(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  ae_bench_buffer buffer(size, 0);
+  buffer.fill_random(1);
+  const ae_memory_range_t range =
+      ae_memory_range_initializer(buffer.begin(), buffer.end());
+
+  for (auto _ : state) {
+    const auto *begin =
+        static_cast<const unsigned char *>(ae_memory_range_get_begin(&range));
+    const auto *end =
+        static_cast<const unsigned char *>(ae_memory_range_get_end(&range));
+
+    uint64_t hash = 14695981039346656037ull;
+    for (const unsigned char *it = begin; it != end; ++it) {
+      hash = (hash ^ *it) * 1099511628211ull;
+    }
+    benchmark::DoNotOptimize(hash);
+  }
+  ae_bench_set_throughput(state, size);
+}
+BENCHMARK(fnv1a_range_bench)->RangeMultiplier(4)->Range(8, 1 << 20);
@@ -0,0 +1,468 @@
+#include <benchmark/benchmark.h>
+#include <ae/memory_raw.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "common.h"
+
+static void ae_memory_raw_copy_bench(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  ae_bench_buffer src(size, static_cast<size_t>(state.range(1)));
+  ae_bench_buffer dst(size, 0);
+  src.fill_random(1);
+
+  for (auto _ : state) {
+    void *result =
+        ae_memory_raw_copy(dst.begin(), dst.end(), src.begin(), src.end());
+    benchmark::DoNotOptimize(result);
+    benchmark::ClobberMemory();
+  }
+  ae_bench_set_throughput(state, size);
+}
+BENCHMARK(ae_memory_raw_copy_bench)->Apply(ae_bench_size_and_misalignment);
+
+static void libc_memcpy_bench(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  ae_bench_buffer src(size, static_cast<size_t>(state.range(1)));
+  ae_bench_buffer dst(size, 0);
+  src.fill_random(1);
+
+  for (auto _ : state) {
+    void *result = memcpy(dst.begin(), src.begin(), size);
+    benchmark::DoNotOptimize(result);
+    benchmark::ClobberMemory();
+  }
+  ae_bench_set_throughput(state, size);
+}
+BENCHMARK(libc_memcpy_bench)->Apply(ae_bench_size_and_misalignment);
+
+static void ae_memory_raw_copy_from_end_bench(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  ae_bench_buffer src(size, static_cast<size_t>(state.range(1)));
+  ae_bench_buffer dst(size, 0);
+  src.fill_random(1);
+
+  for (auto _ : state) {
+    void *result = ae_memory_raw_copy_from_end(dst.begin(), dst.end(),
+                                               src.begin(), src.end());
+    benchmark::DoNotOptimize(result);
+    benchmark::ClobberMemory();
+  }
+  ae_bench_set_throughput(state, size);
+}
+BENCHMARK(ae_memory_raw_copy_from_end_bench)
+    ->Apply(ae_bench_size_and_misalignment);
+
+// Перемещение внутри одного буфера: приёмник перекрывает источник
+// и расположен правее него, как при сдвиге данных к концу буфера.
+static void ae_memory_raw_move_bench(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  const auto misalignment = static_cast<size_t>(state.range(1));
+  ae_bench_buffer buffer(size + ae_bench_alignment, 0);
+  buffer.fill_random(1);
+
+  unsigned char *src = buffer.begin() + misalignment;
+  unsigned char *dst = buffer.begin() + ae_bench_alignment;
+
+  for (auto _ : state) {
+    void *result = ae_memory_raw_move(dst, dst + size, src, src + size);
+    benchmark::DoNotOptimize(result);
+    benchmark::ClobberMemory();
+  }
+  ae_bench_set_throughput(state, size);
+}
+BENCHMARK(ae_memory_raw_move_bench)->Apply(ae_bench_size_and_misalignment);
+
+static void libc_memmove_bench(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  const auto misalignment = static_cast<size_t>(state.range(1));
+  ae_bench_buffer buffer(size + ae_bench_alignment, 0);
+  buffer.fill_random(1);
+
+  unsigned char *src = buffer.begin() + misalignment;
+  unsigned char *dst = buffer.begin() + ae_bench_alignment;
+
+  for (auto _ : state) {
+    void *result = memmove(dst, src, size);
+    benchmark::DoNotOptimize(result);
+    benchmark::ClobberMemory();
+  }
+  ae_bench_set_throughput(state, size);
+}
+BENCHMARK(libc_memmove_bench)->Apply(ae_bench_size_and_misalignment);
+
+// Сравнение одинаковых буферов: просматривается весь диапазон.
+static void ae_memory_raw_compare_bench(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  ae_bench_buffer lhs(size, static_cast<size_t>(state.range(1)));
+  ae_bench_buffer rhs(size, 0);
+  lhs.fill_random(1);
+  rhs.fill_random(1);
+
+  for (auto _ : state) {
+    const void *result =
+        ae_memory_raw_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    benchmark::DoNotOptimize(result);
+  }
+  ae_bench_set_throughput(state, size);
+}
+BENCHMARK(ae_memory_raw_compare_bench)->Apply(ae_bench_size_and_misalignment);
+
+static void libc_memcmp_bench(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  ae_bench_buffer lhs(size, static_cast<size_t>(state.range(1)));
+  ae_bench_buffer rhs(size, 0);
+  lhs.fill_random(1);
+  rhs.fill_random(1);
+
+  for (auto _ : state) {
+    int result = memcmp(lhs.begin(), rhs.begin(), size);
+    benchmark::DoNotOptimize(result);
+  }
+  ae_bench_set_throughput(state, size);
+}
+BENCHMARK(libc_memcmp_bench)->Apply(ae_bench_size_and_misalignment);
+
+// Сравнение 4 КиБ страниц с одним различием в позиции `mismatch`;
+// позиция, равная размеру страницы, означает одинаковые страницы.
+static void ae_bench_page_mismatch(benchmark::internal::Benchmark *b) {
+  b->ArgName("mismatch");
+  for (int64_t mismatch : {0, 15, 16, 63, 64, 2047, 4095, 4096}) {
+    b->Arg(mismatch);
+  }
+}
+
+static void ae_memory_raw_compare_page_bench(benchmark::State &state) {
+  const auto mismatch = static_cast<size_t>(state.range(0));
+  ae_bench_buffer lhs(4096, 0);
+  ae_bench_buffer rhs(4096, 0);
+  lhs.fill_random(1);
+  rhs.fill_random(1);
+  if (mismatch < rhs.size()) {
+    rhs.begin()[mismatch] ^= 0xFF;
+  }
+
+  for (auto _ : state) {
+    const void *result =
+        ae_memory_raw_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    benchmark::DoNotOptimize(result);
+  }
+  ae_bench_set_throughput(state, std::min<size_t>(mismatch + 1, lhs.size()));
+}
+BENCHMARK(ae_memory_raw_compare_page_bench)->Apply(ae_bench_page_mismatch);
+
+static void ae_memory_raw_compare_from_end_page_bench(benchmark::State &state) {
+  const auto mismatch = static_cast<size_t>(state.range(0));
+  ae_bench_buffer lhs(4096, 0);
+  ae_bench_buffer rhs(4096, 0);
+  lhs.fill_random(1);
+  rhs.fill_random(1);
+  if (mismatch < rhs.size()) {
+    rhs.begin()[mismatch] ^= 0xFF;
+  }
+
+  for (auto _ : state) {
+    const void *result = ae_memory_raw_compare_from_end(lhs.begin(), lhs.end(),
+                                                        rhs.begin(), rhs.end());
+    benchmark::DoNotOptimize(result);
+  }
+  ae_bench_set_throughput(
+      state, mismatch < lhs.size() ? lhs.size() - mismatch : lhs.size());
+}
+BENCHMARK(ae_memory_raw_compare_from_end_page_bench)
+    ->Apply(ae_bench_page_mismatch);
+
+static void libc_memcmp_page_bench(benchmark::State &state) {
+  const auto mismatch = static_cast<size_t>(state.range(0));
+  ae_bench_buffer lhs(4096, 0);
+  ae_bench_buffer rhs(4096, 0);
+  lhs.fill_random(1);
+  rhs.fill_random(1);
+  if (mismatch < rhs.size()) {
+    rhs.begin()[mismatch] ^= 0xFF;
+  }
+
+  for (auto _ : state) {
+    int result = memcmp(lhs.begin(), rhs.begin(), lhs.size());
+    benchmark::DoNotOptimize(result);
+  }
+  ae_bench_set_throughput(state, std::min<size_t>(mismatch + 1, lhs.size()));
+}
+BENCHMARK(libc_memcmp_page_bench)->Apply(ae_bench_page_mismatch);
+
+// Искомая последовательность - последние байты псевдослучайного буфера,
+// поэтому поиск проходит весь диапазон.
+static void ae_memory_raw_find_bench(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  ae_bench_buffer haystack(size, static_cast<size_t>(state.range(1)));
+  haystack.fill_random(1);
+
+  const size_t needle_size = std::min<size_t>(size, 8);
+  const unsigned char *needle = haystack.end() - needle_size;
+
+  for (auto _ : state) {
+    const void *result = ae_memory_raw_find(haystack.begin(), haystack.end(),
+                                            needle, needle + needle_size);
+    benchmark::DoNotOptimize(result);
+  }
+  ae_bench_set_throughput(state, size);
+}
+BENCHMARK(ae_memory_raw_find_bench)->Apply(ae_bench_size_and_misalignment);
+
+#if defined(__GLIBC__)
+static void libc_memmem_bench(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  ae_bench_buffer haystack(size, static_cast<size_t>(state.range(1)));
+  haystack.fill_random(1);
+
+  const size_t needle_size = std::min<size_t>(size, 8);
+  const unsigned char *needle = haystack.end() - needle_size;
+
+  for (auto _ : state) {
+    void *result = memmem(haystack.begin(), size, needle, needle_size);
+    benchmark::DoNotOptimize(result);
+  }
+  ae_bench_set_throughput(state, size);
+}
+BENCHMARK(libc_memmem_bench)->Apply(ae_bench_size_and_misalignment);
+#endif
+
+// Худший случай для наивного поиска: стог "aaaa...a", игла "aa...ab".
+static void ae_bench_adversarial(benchmark::internal::Benchmark *b) {
+  b->ArgNames({"size", "needle"});
+  for (int64_t size : {int64_t{64} << 10, int64_t{1} << 20, int64_t{4} << 20}) {
+    for (int64_t needle : {16, 64, 256}) {
+      b->Args({size, needle});
+    }
+  }
+}
+
+static void ae_memory_raw_find_adversarial_bench(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  std::vector<unsigned char> haystack(size, 'a');
+  std::vector<unsigned char> needle(static_cast<size_t>(state.range(1)), 'a');
+  needle.back() = 'b';
+
+  for (auto _ : state) {
+    const void *result =
+        ae_memory_raw_find(haystack.data(), haystack.data() + haystack.size(),
+                           needle.data(), needle.data() + needle.size());
+    benchmark::DoNotOptimize(result);
+  }
+  ae_bench_set_throughput(state, size);
+}
+BENCHMARK(ae_memory_raw_find_adversarial_bench)->Apply(ae_bench_adversarial);
+
+static void ae_memory_raw_find_from_end_adversarial_bench(
+    benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  std::vector<unsigned char> haystack(size, 'a');
+  std::vector<unsigned char> needle(static_cast<size_t>(state.range(1)), 'a');
+  needle.front() = 'b';
+
+  for (auto _ : state) {
+    const void *result = ae_memory_raw_find_from_end(
+        haystack.data(), haystack.data() + haystack.size(), needle.data(),
+        needle.data() + needle.size());
+    benchmark::DoNotOptimize(result);
+  }
+  ae_bench_set_throughput(state, size);
+}
+BENCHMARK(ae_memory_raw_find_from_end_adversarial_bench)
+    ->Apply(ae_bench_adversarial);
+
+#if defined(__GLIBC__)
+static void libc_memmem_adversarial_bench(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  std::vector<unsigned char> haystack(size, 'a');
+  std::vector<unsigned char> needle(static_cast<size_t>(state.range(1)), 'a');
+  needle.back() = 'b';
+
+  for (auto _ : state) {
+    void *result = memmem(haystack.data(), haystack.size(), needle.data(),
+                          needle.size());
+    benchmark::DoNotOptimize(result);
+  }
+  ae_bench_set_throughput(state, size);
+}
+BENCHMARK(libc_memmem_adversarial_bench)->Apply(ae_bench_adversarial);
+#endif
+
+// Поиск одной и той же иглы в множестве небольших буферов: каждый вызов
+// заново разбирает иглу, что задаёт базовую линию для повторного поиска.
+static void ae_bench_repeated_needle(benchmark::internal::Benchmark *b) {
+  b->ArgNames({"buffer", "needle"});
+  for (int64_t buffer : {64, 256, 1024}) {
+    for (int64_t needle : {4, 16}) {
+      b->Args({buffer, needle});
+    }
+  }
+}
+
+static void ae_memory_raw_find_repeated_bench(benchmark::State &state) {
+  const auto buffer_size = static_cast<size_t>(state.range(0));
+  const auto needle_size = static_cast<size_t>(state.range(1));
+  const size_t buffer_count = 1024;
+
+  ae_bench_buffer buffers(buffer_size * buffer_count, 0);
+  buffers.fill_random(1);
+  ae_bench_buffer needle(needle_size, 0);
+  needle.fill_random(2);
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < buffer_count; ++i) {
+      const unsigned char *begin = buffers.begin() + i * buffer_size;
+      const void *result = ae_memory_raw_find(begin, begin + buffer_size,
+                                              needle.begin(), needle.end());
+      benchmark::DoNotOptimize(result);
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(buffer_count));
+  ae_bench_set_throughput(state, buffers.size());
+}
+BENCHMARK(ae_memory_raw_find_repeated_bench)->Apply(ae_bench_repeated_needle);
+
+#if defined(__GLIBC__)
+static void libc_memmem_repeated_bench(benchmark::State &state) {
+  const auto buffer_size = static_cast<size_t>(state.range(0));
+  const auto needle_size = static_cast<size_t>(state.range(1));
+  const size_t buffer_count = 1024;
+
+  ae_bench_buffer buffers(buffer_size * buffer_count, 0);
+  buffers.fill_random(1);
+  ae_bench_buffer needle(needle_size, 0);
+  needle.fill_random(2);
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < buffer_count; ++i) {
+      void *result = memmem(buffers.begin() + i * buffer_size, buffer_size,
+                            needle.begin(), needle_size);
+      benchmark::DoNotOptimize(result);
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(buffer_count));
+  ae_bench_set_throughput(state, buffers.size());
+}
+BENCHMARK(libc_memmem_repeated_bench)->Apply(ae_bench_repeated_needle);
+#endif
+
+// Таблицы CRC32C (полином Кастаньоли, отражённая форма 0x82F63B78)
+// для программного расчёта методом slicing-by-8.
+class ae_bench_crc32c_tables {
+public:
+  ae_bench_crc32c_tables() {
+    for (uint32_t i = 0; i < 256; ++i) {
+      uint32_t crc = i;
+      for (int bit = 0; bit < 8; ++bit) {
+        crc = (crc >> 1) ^ (0x82F63B78u & (0u - (crc & 1u)));
+      }
+      tables_[0][i] = crc;
+    }
+    for (uint32_t i = 0; i < 256; ++i) {
+      for (size_t slice = 1; slice < 8; ++slice) {
+        const uint32_t previous = tables_[slice - 1][i];
+        tables_[slice][i] = (previous >> 8) ^ tables_[0][previous & 0xFF];
+      }
+    }
+  }
+
+  uint32_t update(uint32_t crc, const unsigned char *begin,
+                  const unsigned char *end) const {
+    crc = ~crc;
+    for (; end - begin >= 8; begin += 8) {
+      uint32_t low;
+      uint32_t high;
+      memcpy(&low, begin, sizeof(low));
+      memcpy(&high, begin + 4, sizeof(high));
+      low ^= crc;
+      crc = tables_[7][low & 0xFF] ^ tables_[6][(low >> 8) & 0xFF] ^
+            tables_[5][(low >> 16) & 0xFF] ^ tables_[4][low >> 24] ^
+            tables_[3][high & 0xFF] ^ tables_[2][(high >> 8) & 0xFF] ^
+            tables_[1][(high >> 16) & 0xFF] ^ tables_[0][high >> 24];
+    }
+    for (; begin != end; ++begin) {
+      crc = (crc >> 8) ^ tables_[0][(crc ^ *begin) & 0xFF];
+    }
+    return ~crc;
+  }
+
+private:
+  uint32_t tables_[8][256];
+};
+
+static const ae_bench_crc32c_tables ae_bench_crc32c;
+
+// Проверяет программный CRC32C на контрольном значении "123456789"
+// и на 32-байтовых векторах из RFC 3720, приложение B.4.
+static bool ae_bench_crc32c_matches_rfc3720() {
+  const unsigned char check[] = "123456789";
+  if (ae_bench_crc32c.update(0, check, check + 9) != 0xE3069283u) {
+    return false;
+  }
+
+  unsigned char zeros[32];
+  unsigned char ones[32];
+  unsigned char incrementing[32];
+  unsigned char decrementing[32];
+  for (size_t i = 0; i < 32; ++i) {
+    zeros[i] = 0x00;
+    ones[i] = 0xFF;
+    incrementing[i] = static_cast<unsigned char>(i);
+    decrementing[i] = static_cast<unsigned char>(31 - i);
+  }
+
+  return ae_bench_crc32c.update(0, zeros, zeros + 32) == 0x8A9136AAu &&
+         ae_bench_crc32c.update(0, ones, ones + 32) == 0x62A8AB43u &&
+         ae_bench_crc32c.update(0, incrementing, incrementing + 32) ==
+             0x46DD794Eu &&
+         ae_bench_crc32c.update(0, decrementing, decrementing + 32) ==
+             0x113FDB5Cu;
+}
+
+// Программный CRC32C slicing-by-8 - базовая линия для аппаратной версии.
+static void crc32c_slicing_by_8_bench(benchmark::State &state) {
+  if (!ae_bench_crc32c_matches_rfc3720()) {
+    state.SkipWithError("CRC32C does not match RFC 3720 test vectors");
+    return;
+  }
+  const auto size = static_cast<size_t>(state.range(0));
+  ae_bench_buffer src(size, 0);
+  src.fill_random(1);
+
+  for (auto _ : state) {
+    const uint32_t crc = ae_bench_crc32c.update(0, src.begin(), src.end());
+    benchmark::DoNotOptimize(crc);
+  }
+  ae_bench_set_throughput(state, size);
+}
+BENCHMARK(crc32c_slicing_by_8_bench)
+    ->RangeMultiplier(16)
+    ->Range(64, 64 << 20);
+
+// Копирование через ae_memory_raw_copy и отдельный проход CRC32C по
+// приёмнику - базовая линия для совмещённого копирования с подсчётом.
+static void ae_memory_raw_copy_then_crc32c_bench(benchmark::State &state) {
+  if (!ae_bench_crc32c_matches_rfc3720()) {
+    state.SkipWithError("CRC32C does not match RFC 3720 test vectors");
+    return;
+  }
+  const auto size = static_cast<size_t>(state.range(0));
+  ae_bench_buffer src(size, 0);
+  ae_bench_buffer dst(size, 0);
+  src.fill_random(1);
+
+  for (auto _ : state) {
+    ae_memory_raw_copy(dst.begin(), dst.end(), src.begin(), src.end());
+    const uint32_t crc = ae_bench_crc32c.update(0, dst.begin(), dst.end());
+    benchmark::DoNotOptimize(crc);
+    benchmark::ClobberMemory();
+  }
+  ae_bench_set_throughput(state, size);
+}
+BENCHMARK(ae_memory_raw_copy_then_crc32c_bench)
+    ->RangeMultiplier(16)
+    ->Range(64, 64 << 20);
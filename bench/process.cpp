@@ -0,0 +1,55 @@
+#include <benchmark/benchmark.h>
+#include <ae/memory_range_initializer.h>
+#include <ae/memory_range.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <spawn.h>
+#include <sys/wait.h>
+
+extern char **environ;
+#endif
+
+#ifndef AE_BENCH_LINK_MODE
+#define AE_BENCH_LINK_MODE "unknown"
+#endif
+
+// Задержка одного вызова функции ae через PLT разделяемой библиотеки.
+static void ae_call_latency_bench(benchmark::State &state) {
+  char data[16];
+  const ae_memory_range_t range = ae_memory_range_initializer(data, data + 16);
+  const ae_memory_range_t *ptr = &range;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ptr);
+    ae_usize_t result = ae_memory_range_size(ptr);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetLabel(AE_BENCH_LINK_MODE);
+}
+BENCHMARK(ae_call_latency_bench);
+
+#if defined(AE_BENCH_STARTUP_PATH) && (defined(__unix__) || defined(__APPLE__))
+// Время запуска и завершения процесса ae_startup, включая загрузку
+// и динамическое связывание ae.
+static void process_startup_bench(benchmark::State &state) {
+  char path[] = AE_BENCH_STARTUP_PATH;
+  char *argv[] = {path, nullptr};
+
+  for (auto _ : state) {
+    pid_t pid;
+    if (posix_spawn(&pid, path, nullptr, nullptr, argv, environ) != 0) {
+      state.SkipWithError("posix_spawn failed");
+      break;
+    }
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      state.SkipWithError("ae_startup failed");
+      break;
+    }
+  }
+  state.SetLabel(AE_BENCH_LINK_MODE);
+}
+BENCHMARK(process_startup_bench)->UseRealTime();
+#endif
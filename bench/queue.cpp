@@ -0,0 +1,153 @@
+#include <benchmark/benchmark.h>
+#include <ae/memory_block_initializer.h>
+#include <ae/memory_block.h>
+#include <ae/memory_raw.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Размер записи, передаваемой между потоками конвейера.
+static const size_t ae_bench_record_size = 64;
+
+// Количество записей, передаваемых за одну итерацию.
+static const size_t ae_bench_record_count = size_t{1} << 20;
+
+struct ae_bench_record {
+  uint8_t bytes[ae_bench_record_size];
+};
+
+// Текущее время монотонных часов в наносекундах.
+static int64_t ae_bench_now_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// Очередь на мьютексе и std::deque - базовая линия для кольцевых буферов.
+// Производители копируют записи из блока-источника через
+// ae_memory_raw_copy, потребители - в свой блок-приёмник, ожидая
+// записи на условной переменной.
+// Каждая запись помечается временем постановки в очередь; счётчики
+// latency_mean и latency_p99 - время от постановки до извлечения.
+static void mutex_deque_queue_bench(benchmark::State &state) {
+  const auto producers = static_cast<size_t>(state.range(0));
+  const auto consumers = static_cast<size_t>(state.range(1));
+  const size_t per_producer = ae_bench_record_count / producers;
+  const size_t total = per_producer * producers;
+
+  std::vector<ae_bench_record> source(per_producer);
+  for (size_t i = 0; i < per_producer; ++i) {
+    source[i].bytes[sizeof(int64_t)] = static_cast<uint8_t>(i);
+  }
+  const ae_memory_block_t source_block = ae_memory_block_initializer(
+      source.data(), source.data() + source.size(), sizeof(ae_bench_record));
+
+  // Буферы задержек резервируются один раз, вне измеряемого цикла.
+  std::vector<std::vector<int64_t>> consumer_latencies(consumers);
+  for (std::vector<int64_t> &latency : consumer_latencies) {
+    latency.reserve(total);
+  }
+  std::vector<int64_t> latencies;
+
+  for (auto _ : state) {
+    std::deque<ae_bench_record> queue;
+    std::mutex mutex;
+    std::condition_variable not_empty;
+    size_t taken = 0;
+    size_t waiting = 0;
+    std::vector<std::thread> threads;
+
+    for (size_t p = 0; p < producers; ++p) {
+      threads.emplace_back([&] {
+        for (size_t i = 0; i < per_producer; ++i) {
+          const auto *slot = static_cast<const uint8_t *>(
+              ae_memory_block_at(&source_block, i, false));
+          ae_bench_record record;
+          ae_memory_raw_copy(record.bytes, record.bytes + sizeof(record),
+                             slot, slot + sizeof(record));
+
+          bool wake = false;
+          {
+            const std::lock_guard<std::mutex> lock(mutex);
+            const int64_t stamp = ae_bench_now_ns();
+            memcpy(record.bytes, &stamp, sizeof(stamp));
+            queue.push_back(record);
+            wake = waiting > 0;
+          }
+          if (wake) {
+            not_empty.notify_one();
+          }
+        }
+      });
+    }
+
+    for (size_t c = 0; c < consumers; ++c) {
+      threads.emplace_back([&, c] {
+        std::vector<int64_t> &latency = consumer_latencies[c];
+        ae_bench_record sink;
+        for (;;) {
+          {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (queue.empty() && taken != total) {
+              ++waiting;
+              not_empty.wait(lock);
+              --waiting;
+            }
+            if (queue.empty()) {
+              break;
+            }
+            const uint8_t *front = queue.front().bytes;
+            ae_memory_raw_copy(sink.bytes, sink.bytes + sizeof(sink), front,
+                               front + sizeof(sink));
+            queue.pop_front();
+            if (++taken == total) {
+              not_empty.notify_all();
+            }
+          }
+          int64_t stamp;
+          memcpy(&stamp, sink.bytes, sizeof(stamp));
+          latency.push_back(ae_bench_now_ns() - stamp);
+        }
+        benchmark::DoNotOptimize(sink);
+      });
+    }
+
+    for (std::thread &thread : threads) {
+      thread.join();
+    }
+
+    state.PauseTiming();
+    for (std::vector<int64_t> &latency : consumer_latencies) {
+      latencies.insert(latencies.end(), latency.begin(), latency.end());
+      latency.clear();
+    }
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(total));
+
+  if (!latencies.empty()) {
+    int64_t sum = 0;
+    for (const int64_t latency : latencies) {
+      sum += latency;
+    }
+    const auto p99 = latencies.begin() + latencies.size() * 99 / 100;
+    std::nth_element(latencies.begin(), p99, latencies.end());
+
+    state.counters["latency_mean"] =
+        static_cast<double>(sum) / static_cast<double>(latencies.size()) *
+        1e-9;
+    state.counters["latency_p99"] = static_cast<double>(*p99) * 1e-9;
+  }
+}
+BENCHMARK(mutex_deque_queue_bench)
+    ->ArgNames({"producers", "consumers"})
+    ->ArgsProduct({{1, 2, 4}, {1, 2, 4}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,7 @@
+#include <ae/str_raw.h>
+
+// Запускается бенчмарком process_startup_bench: загрузка, разрешение
+// символов ae и один вызов библиотеки.
+int main(int argc, char **argv) {
+  return argc > 0 && ae_str_raw_len(argv[0]) > 0 ? 0 : 1;
+}
@@ -0,0 +1,134 @@
+#include <benchmark/benchmark.h>
+#include <ae/str_raw.h>
+#include <cstring>
+
+#include "common.h"
+
+// Строка из `size` ненулевых символов с завершающим нулём.
+static ae_bench_buffer ae_bench_make_string(size_t size, size_t misalignment) {
+  ae_bench_buffer buffer(size + 1, misalignment);
+  memset(buffer.begin(), 'x', size);
+  buffer.begin()[size] = '\0';
+  return buffer;
+}
+
+static void ae_bench_string_size(benchmark::internal::Benchmark *b) {
+  b->ArgNames({"size", "misalignment"});
+  for (int64_t size = 1; size <= int64_t{64} << 10; size *= 4) {
+    for (int64_t misalignment : {0, 1, 31}) {
+      b->Args({size, misalignment});
+    }
+  }
+}
+
+static void ae_str_raw_len_bench(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  ae_bench_buffer str =
+      ae_bench_make_string(size, static_cast<size_t>(state.range(1)));
+  const auto *data = reinterpret_cast<const ae_char_t *>(str.begin());
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(data);
+    ae_usize_t result = ae_str_raw_len(data);
+    benchmark::DoNotOptimize(result);
+  }
+  ae_bench_set_throughput(state, size);
+}
+BENCHMARK(ae_str_raw_len_bench)->Apply(ae_bench_string_size);
+
+static void ae_str_raw_find_of_null_terminator_bench(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  ae_bench_buffer str =
+      ae_bench_make_string(size, static_cast<size_t>(state.range(1)));
+  const auto *data = reinterpret_cast<const ae_char_t *>(str.begin());
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(data);
+    const ae_char_t *result = ae_str_raw_find_of_null_terminator(data);
+    benchmark::DoNotOptimize(result);
+  }
+  ae_bench_set_throughput(state, size);
+}
+BENCHMARK(ae_str_raw_find_of_null_terminator_bench)
+    ->Apply(ae_bench_string_size);
+
+static void libc_strlen_bench(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  ae_bench_buffer str =
+      ae_bench_make_string(size, static_cast<size_t>(state.range(1)));
+  const auto *data = reinterpret_cast<const char *>(str.begin());
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(data);
+    size_t result = strlen(data);
+    benchmark::DoNotOptimize(result);
+  }
+  ae_bench_set_throughput(state, size);
+}
+BENCHMARK(libc_strlen_bench)->Apply(ae_bench_string_size);
+
+static void ae_str_raw_find_char_bench(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  ae_bench_buffer buffer(size, 0);
+  memset(buffer.begin(), 'a', size);
+  buffer.begin()[size - 1] = 'z';
+  const auto *data = reinterpret_cast<const ae_char_t *>(buffer.begin());
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(data);
+    const ae_char_t *result = ae_str_raw_find_char(data, size, 'z');
+    benchmark::DoNotOptimize(result);
+  }
+  ae_bench_set_throughput(state, size);
+}
+BENCHMARK(ae_str_raw_find_char_bench)->Apply(ae_bench_find_char_size);
+
+static void libc_memchr_bench(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  ae_bench_buffer buffer(size, 0);
+  memset(buffer.begin(), 'a', size);
+  buffer.begin()[size - 1] = 'z';
+  const unsigned char *data = buffer.begin();
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(data);
+    const void *result = memchr(data, 'z', size);
+    benchmark::DoNotOptimize(result);
+  }
+  ae_bench_set_throughput(state, size);
+}
+BENCHMARK(libc_memchr_bench)->Apply(ae_bench_find_char_size);
+
+static void ae_bench_fill_size(benchmark::internal::Benchmark *b) {
+  b->ArgNames({"size", "misalignment"});
+  for (int64_t size = 16; size <= ae_bench_max_size; size *= 16) {
+    for (int64_t misalignment : {0, 1, 31}) {
+      b->Args({size, misalignment});
+    }
+  }
+}
+
+static void ae_str_raw_set_value_bench(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  ae_bench_buffer buffer(size, static_cast<size_t>(state.range(1)));
+  auto *data = reinterpret_cast<ae_char_t *>(buffer.begin());
+
+  for (auto _ : state) {
+    ae_str_raw_set_value(data, size, ' ');
+    benchmark::ClobberMemory();
+  }
+  ae_bench_set_throughput(state, size);
+}
+BENCHMARK(ae_str_raw_set_value_bench)->Apply(ae_bench_fill_size);
+
+static void libc_memset_bench(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  ae_bench_buffer buffer(size, static_cast<size_t>(state.range(1)));
+
+  for (auto _ : state) {
+    memset(buffer.begin(), ' ', size);
+    benchmark::ClobberMemory();
+  }
+  ae_bench_set_throughput(state, size);
+}
+BENCHMARK(libc_memset_bench)->Apply(ae_bench_fill_size);
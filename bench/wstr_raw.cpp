@@ -0,0 +1,67 @@
+#include <benchmark/benchmark.h>
+#include <ae/wstr_raw.h>
+#include <cwchar>
+#include <vector>
+
+#include "common.h"
+
+static void ae_wstr_raw_find_char_bench(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  std::vector<ae_wchar_t> buffer(size, L'a');
+  buffer.back() = L'z';
+  const ae_wchar_t *data = buffer.data();
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(data);
+    const ae_wchar_t *result = ae_wstr_raw_find_char(data, size, L'z');
+    benchmark::DoNotOptimize(result);
+  }
+  ae_bench_set_throughput(state, size * sizeof(ae_wchar_t));
+}
+BENCHMARK(ae_wstr_raw_find_char_bench)->Apply(ae_bench_find_char_size);
+
+static void libc_wmemchr_bench(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  std::vector<wchar_t> buffer(size, L'a');
+  buffer.back() = L'z';
+  const wchar_t *data = buffer.data();
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(data);
+    const wchar_t *result = wmemchr(data, L'z', size);
+    benchmark::DoNotOptimize(result);
+  }
+  ae_bench_set_throughput(state, size * sizeof(wchar_t));
+}
+BENCHMARK(libc_wmemchr_bench)->Apply(ae_bench_find_char_size);
+
+static void ae_bench_wfill_size(benchmark::internal::Benchmark *b) {
+  b->ArgName("size");
+  for (int64_t size = 16; size <= ae_bench_max_size / 4; size *= 16) {
+    b->Arg(size);
+  }
+}
+
+static void ae_wstr_raw_set_value_bench(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  std::vector<ae_wchar_t> buffer(size);
+
+  for (auto _ : state) {
+    ae_wstr_raw_set_value(buffer.data(), size, L' ');
+    benchmark::ClobberMemory();
+  }
+  ae_bench_set_throughput(state, size * sizeof(ae_wchar_t));
+}
+BENCHMARK(ae_wstr_raw_set_value_bench)->Apply(ae_bench_wfill_size);
+
+static void libc_wmemset_bench(benchmark::State &state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  std::vector<wchar_t> buffer(size);
+
+  for (auto _ : state) {
+    wmemset(buffer.data(), L' ', size);
+    benchmark::ClobberMemory();
+  }
+  ae_bench_set_throughput(state, size * sizeof(wchar_t));
+}
+BENCHMARK(libc_wmemset_bench)->Apply(ae_bench_wfill_size);
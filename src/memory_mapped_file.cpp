@@ -0,0 +1,171 @@
+#include <ae/memory_block_initializer.h>
+#include <ae/memory_range_initializer.h>
+#include <ae/runtime_error_code.h>
+#include <ae/runtime_error.h>
+#include <ae/memory_block.h>
+#include <ae/memory_range.h>
+#include <ae/memory_raw.h>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Временный файл с заданным содержимым, отображённый в память.
+// Отображение снимается, а файл удаляется при разрушении объекта.
+class mapped_file {
+public:
+  mapped_file(const std::vector<ae_u8_t> &content, bool writable)
+      : path_(testing::TempDir() + "ae_mapped_file_XXXXXX"),
+        size_(content.size()) {
+    fd_ = mkstemp(&path_[0]);
+    if (fd_ < 0) {
+      return;
+    }
+
+    if (write(fd_, content.data(), size_) != static_cast<ssize_t>(size_)) {
+      return;
+    }
+
+    void *data = mmap(nullptr, size_,
+                      writable ? PROT_READ | PROT_WRITE : PROT_READ,
+                      writable ? MAP_SHARED : MAP_PRIVATE, fd_, 0);
+    data_ = data == MAP_FAILED ? nullptr : static_cast<ae_u8_t *>(data);
+  }
+
+  ~mapped_file() {
+    if (data_) {
+      munmap(data_, size_);
+    }
+    if (fd_ >= 0) {
+      close(fd_);
+      unlink(path_.c_str());
+    }
+  }
+
+  mapped_file(const mapped_file &) = delete;
+  mapped_file &operator=(const mapped_file &) = delete;
+
+  ae_u8_t *begin() const {
+    return data_;
+  }
+
+  ae_u8_t *end() const {
+    return data_ + size_;
+  }
+
+  const std::string &path() const {
+    return path_;
+  }
+
+private:
+  std::string path_;
+  int fd_ = -1;
+  ae_u8_t *data_ = nullptr;
+  size_t size_;
+};
+
+// Содержимое файла: неповторяющийся в пределах 251 байта шаблон.
+static std::vector<ae_u8_t> make_file_content(size_t size) {
+  std::vector<ae_u8_t> content(size);
+  for (size_t i = 0; i < size; ++i) {
+    content[i] = static_cast<ae_u8_t>(i % 251);
+  }
+  return content;
+}
+
+TEST(ae_memory_range_mapped_file, range_covers_whole_file) {
+  const size_t size = (size_t{1} << 20) + 3;
+  const mapped_file file(make_file_content(size), false);
+  ASSERT_NE(file.begin(), nullptr);
+
+  const ae_memory_range_t range =
+      ae_memory_range_initializer(file.begin(), file.end());
+
+  EXPECT_EQ(ae_memory_range_get_begin(&range), file.begin());
+  EXPECT_EQ(ae_memory_range_get_end(&range), file.end());
+  EXPECT_EQ(ae_memory_range_size(&range), size);
+  EXPECT_FALSE(ae_memory_range_is_empty(&range));
+}
+
+TEST(ae_memory_block_mapped_file, element_count_matches_records) {
+  const size_t record_count = 1000;
+  std::vector<ae_u8_t> content(record_count * sizeof(uint32_t));
+  for (uint32_t i = 0; i < record_count; ++i) {
+    memcpy(&content[i * sizeof(uint32_t)], &i, sizeof(i));
+  }
+
+  const mapped_file file(content, false);
+  ASSERT_NE(file.begin(), nullptr);
+
+  const ae_memory_block_t block =
+      ae_memory_block_initializer(file.begin(), file.end(), sizeof(uint32_t));
+
+  EXPECT_EQ(ae_memory_block_size(&block), record_count);
+  EXPECT_EQ(*static_cast<const uint32_t *>(ae_memory_block_front(&block)), 0);
+  EXPECT_EQ(*static_cast<const uint32_t *>(ae_memory_block_back(&block)),
+            record_count - 1);
+  EXPECT_EQ(
+      *static_cast<const uint32_t *>(ae_memory_block_at(&block, 500, false)),
+      500);
+  EXPECT_EQ(ae_memory_block_at(&block, record_count, false), nullptr);
+  EXPECT_EQ(ae_error_get_code_and_clear(ae_runtime_error()),
+            AE_RUNTIME_ERROR_OUT_OF_RANGE);
+}
+
+TEST(ae_memory_raw_find_mapped_file, finds_needle_near_end_of_file) {
+  const size_t size = size_t{8} << 20;
+  std::vector<ae_u8_t> content = make_file_content(size);
+  const ae_u8_t needle[] = {0xFF, 0xFE, 0xFD, 0xFC, 0xFB, 0xFA, 0xF9, 0xF8};
+  const size_t offset = size - 100;
+  memcpy(&content[offset], needle, sizeof(needle));
+
+  const mapped_file file(content, false);
+  ASSERT_NE(file.begin(), nullptr);
+
+  EXPECT_EQ(ae_memory_raw_find(file.begin(), file.end(), needle,
+                               needle + sizeof(needle)),
+            file.begin() + offset);
+  EXPECT_EQ(ae_memory_raw_find_from_end(file.begin(), file.end(), needle,
+                                        needle + sizeof(needle)),
+            file.begin() + offset);
+}
+
+TEST(ae_memory_raw_copy_mapped_file, msync_persists_records_across_reopen) {
+  const size_t size = 3 * 4096 + 17;
+  std::vector<ae_u8_t> expected = make_file_content(size);
+  const ae_u8_t record[] = {'r', 'e', 'c', 'o', 'r', 'd'};
+  const size_t offsets[] = {0, 4096 - 3, 2 * 4096, size - sizeof(record)};
+
+  const mapped_file file(expected, true);
+  ASSERT_NE(file.begin(), nullptr);
+
+  // Записи, в том числе пересекающие границу страницы, копируются
+  // в разделяемое отображение и сбрасываются в файл через msync.
+  for (size_t offset : offsets) {
+    ae_u8_t *dst = file.begin() + offset;
+    ae_memory_raw_copy(dst, dst + sizeof(record), record,
+                       record + sizeof(record));
+    memcpy(&expected[offset], record, sizeof(record));
+  }
+  ASSERT_EQ(msync(file.begin(), size, MS_SYNC), 0);
+
+  // Новое отображение заново открытого файла видит сохранённые записи.
+  const int fd = open(file.path().c_str(), O_RDONLY);
+  ASSERT_GE(fd, 0);
+  void *data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  ASSERT_NE(data, MAP_FAILED);
+
+  const auto *begin = static_cast<const ae_u8_t *>(data);
+  EXPECT_EQ(ae_memory_raw_compare(begin, begin + size, expected.data(),
+                                  expected.data() + size),
+            nullptr);
+  munmap(data, size);
+}
+#endif
@@ -2,6 +2,50 @@
 #include <ae/runtime_error_code.h>
 #include <ae/runtime_error.h>
 #include <ae/memory_raw.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+// Наибольшее смещение начала диапазона относительно выровненного адреса.
+static const size_t max_misalignment = 64;
+
+// Наибольшая длина, на которой перебираются все размеры: покрывает
+// головы и хвосты векторных ядер шириной до 64 байт.
+static const size_t max_exhaustive_length = 256;
+
+// Заполняет буфер неповторяющимся в пределах 251 байта шаблоном.
+static void fill_pattern(std::vector<ae_u8_t> &buffer, ae_u8_t seed) {
+  for (size_t i = 0; i < buffer.size(); ++i) {
+    buffer[i] = static_cast<ae_u8_t>((i % 251) + seed);
+  }
+}
+
+// Размер страницы, на которой проверяется поиск несовпадений.
+static const size_t page_size = 4096;
+
+// Возвращает адрес, смещённый на `misalignment` байт от первой
+// 64-байтовой границы внутри буфера.
+static ae_u8_t *aligned_at(std::vector<ae_u8_t> &buffer, size_t misalignment) {
+  const auto address = reinterpret_cast<uintptr_t>(buffer.data());
+  const auto aligned = (address + max_misalignment - 1) &
+                       ~static_cast<uintptr_t>(max_misalignment - 1);
+  return buffer.data() + (aligned - address) + misalignment;
+}
+
+// Эталонное побайтовое перемещение, корректное при перекрытии.
+static void reference_move(ae_u8_t *dst, const ae_u8_t *src, size_t len) {
+  if (dst < src) {
+    for (size_t i = 0; i < len; ++i) {
+      dst[i] = src[i];
+    }
+  } else {
+    for (size_t i = len; i > 0; --i) {
+      dst[i - 1] = src[i - 1];
+    }
+  }
+}
 
 TEST(ae_memory_raw_compare, null_pointers) {
   EXPECT_EQ(ae_memory_raw_compare(nullptr, nullptr, nullptr, nullptr), nullptr);
@@ -138,6 +182,130 @@ TEST(ae_memory_raw_compare_from_end, compare_same_last_elements) {
             nullptr);
 }
 
+TEST(ae_memory_raw_compare, finds_mismatch_at_every_position_of_page) {
+  std::vector<ae_u8_t> lhs(page_size + max_misalignment);
+  std::vector<ae_u8_t> rhs(page_size + max_misalignment);
+  fill_pattern(lhs, 5);
+
+  for (size_t offset : {0, 1, 31, 33, 63}) {
+    const ae_u8_t *lhs_begin = &lhs[offset];
+    ae_u8_t *rhs_begin = &rhs[0];
+    memcpy(rhs_begin, lhs_begin, page_size);
+
+    for (size_t position = 0; position < page_size; ++position) {
+      rhs_begin[position] ^= 0x80;
+      const void *result = ae_memory_raw_compare(
+          lhs_begin, lhs_begin + page_size, rhs_begin, rhs_begin + page_size);
+      rhs_begin[position] ^= 0x80;
+
+      ASSERT_EQ(result, lhs_begin + position)
+          << "offset=" << offset << " position=" << position;
+    }
+  }
+}
+
+TEST(ae_memory_raw_compare, returns_first_of_mismatches_straddling_lanes) {
+  std::vector<ae_u8_t> lhs(page_size + 2 * max_misalignment);
+  std::vector<ae_u8_t> rhs(page_size + 2 * max_misalignment);
+  fill_pattern(lhs, 9);
+
+  // Пары соседних различий по обе стороны границ 16/32/64-байтовых
+  // векторов; границы отсчитываются от 64-байтового выравнивания.
+  for (size_t misalignment = 0; misalignment < max_misalignment;
+       ++misalignment) {
+    const ae_u8_t *lhs_begin = aligned_at(lhs, misalignment);
+    ae_u8_t *rhs_begin = aligned_at(rhs, misalignment);
+    memcpy(rhs_begin, lhs_begin, page_size);
+
+    for (size_t boundary : {16, 32, 64, 128, 2048, 4032, 4096}) {
+      for (size_t before = 1; before <= 2; ++before) {
+        for (size_t after = 0; after <= 1; ++after) {
+          if (boundary < misalignment + before ||
+              boundary + after >= misalignment + page_size) {
+            continue;
+          }
+          const size_t first = boundary - before - misalignment;
+          const size_t second = boundary + after - misalignment;
+
+          rhs_begin[first] ^= 0x01;
+          rhs_begin[second] ^= 0x01;
+          const void *result =
+              ae_memory_raw_compare(lhs_begin, lhs_begin + page_size,
+                                    rhs_begin, rhs_begin + page_size);
+          rhs_begin[first] ^= 0x01;
+          rhs_begin[second] ^= 0x01;
+
+          ASSERT_EQ(result, lhs_begin + first)
+              << "misalignment=" << misalignment << " boundary=" << boundary
+              << " before=" << before << " after=" << after;
+        }
+      }
+    }
+  }
+}
+
+TEST(ae_memory_raw_compare_from_end,
+     finds_mismatch_at_every_position_of_page) {
+  std::vector<ae_u8_t> lhs(page_size + max_misalignment);
+  std::vector<ae_u8_t> rhs(page_size + max_misalignment);
+  fill_pattern(lhs, 5);
+
+  for (size_t offset : {0, 1, 31, 33, 63}) {
+    const ae_u8_t *lhs_begin = &lhs[offset];
+    ae_u8_t *rhs_begin = &rhs[0];
+    memcpy(rhs_begin, lhs_begin, page_size);
+
+    for (size_t position = 0; position < page_size; ++position) {
+      rhs_begin[position] ^= 0x80;
+      const void *result = ae_memory_raw_compare_from_end(
+          lhs_begin, lhs_begin + page_size, rhs_begin, rhs_begin + page_size);
+      rhs_begin[position] ^= 0x80;
+
+      ASSERT_EQ(result, lhs_begin + position)
+          << "offset=" << offset << " position=" << position;
+    }
+  }
+}
+
+TEST(ae_memory_raw_compare_from_end,
+     returns_last_of_mismatches_straddling_lanes) {
+  std::vector<ae_u8_t> lhs(page_size + 2 * max_misalignment);
+  std::vector<ae_u8_t> rhs(page_size + 2 * max_misalignment);
+  fill_pattern(lhs, 9);
+
+  for (size_t misalignment = 0; misalignment < max_misalignment;
+       ++misalignment) {
+    const ae_u8_t *lhs_begin = aligned_at(lhs, misalignment);
+    ae_u8_t *rhs_begin = aligned_at(rhs, misalignment);
+    memcpy(rhs_begin, lhs_begin, page_size);
+
+    for (size_t boundary : {16, 32, 64, 128, 2048, 4032, 4096}) {
+      for (size_t before = 1; before <= 2; ++before) {
+        for (size_t after = 0; after <= 1; ++after) {
+          if (boundary < misalignment + before ||
+              boundary + after >= misalignment + page_size) {
+            continue;
+          }
+          const size_t first = boundary - before - misalignment;
+          const size_t second = boundary + after - misalignment;
+
+          rhs_begin[first] ^= 0x01;
+          rhs_begin[second] ^= 0x01;
+          const void *result = ae_memory_raw_compare_from_end(
+              lhs_begin, lhs_begin + page_size, rhs_begin,
+              rhs_begin + page_size);
+          rhs_begin[first] ^= 0x01;
+          rhs_begin[second] ^= 0x01;
+
+          ASSERT_EQ(result, lhs_begin + second)
+              << "misalignment=" << misalignment << " boundary=" << boundary
+              << " before=" << before << " after=" << after;
+        }
+      }
+    }
+  }
+}
+
 TEST(ae_memory_raw_copy, copy_with64_divisible_length) {
   const size_t len = 64;
   uint8_t src[len];
@@ -482,4 +650,242 @@ TEST(ae_memory_raw_find_from_end, null_pointer_check) {
   ae_memory_raw_find_from_end(nullptr, &lhs[4], rhs, &rhs[2]);
   EXPECT_EQ(ae_error_get_code_and_clear(ae_runtime_error()),
             AE_RUNTIME_ERROR_NULL_POINTER);
-}
\ No newline at end of file
+}
+
+TEST(ae_memory_raw_copy, matches_reference_for_all_lengths_and_misalignments) {
+  const size_t size = max_exhaustive_length + 2 * max_misalignment;
+  std::vector<ae_u8_t> src(size);
+  std::vector<ae_u8_t> dst(size);
+  std::vector<ae_u8_t> expected(size);
+  fill_pattern(src, 1);
+
+  for (size_t len = 0; len <= max_exhaustive_length; ++len) {
+    for (size_t src_offset = 0; src_offset < max_misalignment; ++src_offset) {
+      for (size_t dst_offset : {0, 1, 8, 31, 32, 63}) {
+        std::fill(dst.begin(), dst.end(), 0xEE);
+        std::fill(expected.begin(), expected.end(), 0xEE);
+        reference_move(&expected[dst_offset], &src[src_offset], len);
+
+        ae_u8_t *dst_begin = &dst[dst_offset];
+        const ae_u8_t *src_begin = &src[src_offset];
+        void *result = ae_memory_raw_copy(dst_begin, dst_begin + len,
+                                          src_begin, src_begin + len);
+
+        ASSERT_EQ(result, dst_begin + len)
+            << "len=" << len << " src_offset=" << src_offset
+            << " dst_offset=" << dst_offset;
+        ASSERT_EQ(dst, expected) << "len=" << len << " src_offset="
+                                 << src_offset << " dst_offset=" << dst_offset;
+      }
+    }
+  }
+}
+
+TEST(ae_memory_raw_copy, matches_reference_beyond_last_level_cache) {
+  // Больше кэша последнего уровня, чтобы задействовать путь
+  // с невременными записями; нечётный хвост проверяет его завершение.
+  const size_t len = (size_t{64} << 20) + 13;
+
+  for (size_t offset : {0, 5}) {
+    std::vector<ae_u8_t> src(len + max_misalignment);
+    std::vector<ae_u8_t> dst(len + max_misalignment, 0xEE);
+    fill_pattern(src, 3);
+
+    void *result = ae_memory_raw_copy(&dst[offset], &dst[offset] + len,
+                                      &src[0], &src[0] + len);
+
+    ASSERT_EQ(result, &dst[offset] + len);
+    ASSERT_EQ(memcmp(&dst[offset], &src[0], len), 0) << "offset=" << offset;
+    ASSERT_EQ(dst[offset + len], 0xEE) << "offset=" << offset;
+  }
+}
+
+TEST(ae_memory_raw_copy_from_end,
+     matches_reference_for_all_lengths_and_misalignments) {
+  const size_t size = max_exhaustive_length + 2 * max_misalignment;
+  std::vector<ae_u8_t> src(size);
+  std::vector<ae_u8_t> dst(size);
+  std::vector<ae_u8_t> expected(size);
+  fill_pattern(src, 7);
+
+  for (size_t len = 0; len <= max_exhaustive_length; ++len) {
+    for (size_t src_offset = 0; src_offset < max_misalignment; ++src_offset) {
+      for (size_t dst_offset : {0, 1, 8, 31, 32, 63}) {
+        std::fill(dst.begin(), dst.end(), 0xEE);
+        std::fill(expected.begin(), expected.end(), 0xEE);
+        reference_move(&expected[dst_offset], &src[src_offset], len);
+
+        ae_u8_t *dst_begin = &dst[dst_offset];
+        const ae_u8_t *src_begin = &src[src_offset];
+        void *result = ae_memory_raw_copy_from_end(dst_begin, dst_begin + len,
+                                                   src_begin, src_begin + len);
+
+        ASSERT_EQ(result, dst_begin)
+            << "len=" << len << " src_offset=" << src_offset
+            << " dst_offset=" << dst_offset;
+        ASSERT_EQ(dst, expected) << "len=" << len << " src_offset="
+                                 << src_offset << " dst_offset=" << dst_offset;
+      }
+    }
+  }
+}
+
+TEST(ae_memory_raw_move, matches_reference_for_all_overlaps) {
+  const size_t size = max_exhaustive_length + 2 * max_misalignment;
+  std::vector<ae_u8_t> buffer(size);
+  std::vector<ae_u8_t> expected(size);
+
+  for (size_t len = 0; len <= max_exhaustive_length; len += 3) {
+    for (size_t src_offset = 0; src_offset < max_misalignment; ++src_offset) {
+      for (size_t dst_offset = 0; dst_offset < max_misalignment;
+           ++dst_offset) {
+        fill_pattern(buffer, 11);
+        fill_pattern(expected, 11);
+        reference_move(&expected[dst_offset], &expected[src_offset], len);
+
+        ae_u8_t *dst_begin = &buffer[dst_offset];
+        const ae_u8_t *src_begin = &buffer[src_offset];
+        void *result = ae_memory_raw_move(dst_begin, dst_begin + len,
+                                          src_begin, src_begin + len);
+
+        ASSERT_EQ(result, dst_begin + len)
+            << "len=" << len << " src_offset=" << src_offset
+            << " dst_offset=" << dst_offset;
+        ASSERT_EQ(buffer, expected) << "len=" << len << " src_offset="
+                                    << src_offset
+                                    << " dst_offset=" << dst_offset;
+      }
+    }
+  }
+}
+
+TEST(ae_memory_raw_move, matches_reference_beyond_last_level_cache) {
+  const size_t len = (size_t{64} << 20) + 13;
+  const size_t shift = 4099;
+
+  std::vector<ae_u8_t> buffer(len + shift);
+  std::vector<ae_u8_t> expected(len + shift);
+
+  // Сдвиг вправо (копирование с конца) и влево (копирование с начала).
+  for (bool forward : {false, true}) {
+    fill_pattern(buffer, 13);
+    fill_pattern(expected, 13);
+
+    ae_u8_t *src = forward ? &buffer[shift] : &buffer[0];
+    ae_u8_t *dst = forward ? &buffer[0] : &buffer[shift];
+    memmove(forward ? &expected[0] : &expected[shift],
+            forward ? &expected[shift] : &expected[0], len);
+
+    void *result = ae_memory_raw_move(dst, dst + len, src, src + len);
+
+    ASSERT_EQ(result, dst + len);
+    ASSERT_TRUE(buffer == expected) << "forward=" << forward;
+  }
+}
+
+// Игла вида "aa...ab": худший случай для наивного поиска в стоге из 'a'.
+static std::vector<ae_u8_t> make_adversarial_needle(size_t needle_len) {
+  std::vector<ae_u8_t> needle(needle_len, 'a');
+  needle.back() = 'b';
+  return needle;
+}
+
+TEST(ae_memory_raw_find, long_needles_in_repetitive_haystack) {
+  for (size_t needle_len : {16, 17, 31, 32, 33, 64, 100, 255, 256}) {
+    const std::vector<ae_u8_t> needle = make_adversarial_needle(needle_len);
+    std::vector<ae_u8_t> haystack(8192, 'a');
+
+    const ae_u8_t *result = static_cast<const ae_u8_t *>(
+        ae_memory_raw_find(&haystack[0], &haystack[0] + haystack.size(),
+                           &needle[0], &needle[0] + needle.size()));
+    ASSERT_EQ(result, nullptr) << "needle_len=" << needle_len;
+
+    haystack.back() = 'b';
+    result = static_cast<const ae_u8_t *>(
+        ae_memory_raw_find(&haystack[0], &haystack[0] + haystack.size(),
+                           &needle[0], &needle[0] + needle.size()));
+    ASSERT_EQ(result, &haystack[0] + haystack.size() - needle_len)
+        << "needle_len=" << needle_len;
+  }
+}
+
+TEST(ae_memory_raw_find, needle_equal_to_haystack) {
+  std::vector<ae_u8_t> haystack(256);
+  fill_pattern(haystack, 17);
+
+  const void *result =
+      ae_memory_raw_find(&haystack[0], &haystack[0] + haystack.size(),
+                         &haystack[0], &haystack[0] + haystack.size());
+  EXPECT_EQ(result, &haystack[0]);
+}
+
+TEST(ae_memory_raw_find, matches_reference_on_small_alphabet) {
+  std::mt19937 engine(42);
+
+  for (int iteration = 0; iteration < 2000; ++iteration) {
+    // Пустой стог дал бы нулевой data() и ошибку NULL_POINTER.
+    std::vector<ae_u8_t> haystack(1 + engine() % 1023);
+    for (ae_u8_t &value : haystack) {
+      value = static_cast<ae_u8_t>('a' + engine() % 2);
+    }
+
+    // Игла либо вырезается из стога, либо генерируется заново.
+    std::vector<ae_u8_t> needle(1 + engine() % 300);
+    if (needle.size() <= haystack.size() && engine() % 2) {
+      const size_t at = engine() % (haystack.size() - needle.size() + 1);
+      std::copy_n(&haystack[at], needle.size(), needle.begin());
+    } else {
+      for (ae_u8_t &value : needle) {
+        value = static_cast<ae_u8_t>('a' + engine() % 2);
+      }
+    }
+
+    const ae_u8_t *begin = haystack.data();
+    const ae_u8_t *end = begin + haystack.size();
+    const ae_u8_t *needle_begin = needle.data();
+    const ae_u8_t *needle_end = needle_begin + needle.size();
+
+    const ae_u8_t *expected =
+        std::search(begin, end, needle_begin, needle_end);
+    const void *result = ae_memory_raw_find(begin, end, needle_begin,
+                                            needle_end);
+    ASSERT_EQ(result, expected == end ? nullptr : expected)
+        << "iteration=" << iteration;
+
+    expected = std::find_end(begin, end, needle_begin, needle_end);
+    result = ae_memory_raw_find_from_end(begin, end, needle_begin,
+                                         needle_end);
+    ASSERT_EQ(result, expected == end ? nullptr : expected)
+        << "iteration=" << iteration;
+  }
+}
+
+TEST(ae_memory_raw_find_from_end, long_needles_in_repetitive_haystack) {
+  for (size_t needle_len : {16, 17, 31, 32, 33, 64, 100, 255, 256}) {
+    std::vector<ae_u8_t> needle = make_adversarial_needle(needle_len);
+    std::reverse(needle.begin(), needle.end());
+    std::vector<ae_u8_t> haystack(8192, 'a');
+
+    const ae_u8_t *result = static_cast<const ae_u8_t *>(
+        ae_memory_raw_find_from_end(&haystack[0],
+                                    &haystack[0] + haystack.size(),
+                                    &needle[0], &needle[0] + needle.size()));
+    ASSERT_EQ(result, nullptr) << "needle_len=" << needle_len;
+
+    haystack.front() = 'b';
+    result = static_cast<const ae_u8_t *>(ae_memory_raw_find_from_end(
+        &haystack[0], &haystack[0] + haystack.size(), &needle[0],
+        &needle[0] + needle.size()));
+    ASSERT_EQ(result, &haystack[0]) << "needle_len=" << needle_len;
+  }
+}
+
+TEST(ae_memory_raw_find_from_end, returns_last_of_overlapping_matches) {
+  const std::vector<ae_u8_t> haystack(100, 'a');
+  const std::vector<ae_u8_t> needle(32, 'a');
+
+  const void *result = ae_memory_raw_find_from_end(
+      &haystack[0], &haystack[0] + haystack.size(), &needle[0],
+      &needle[0] + needle.size());
+  EXPECT_EQ(result, &haystack[0] + haystack.size() - needle.size());
+}
@@ -0,0 +1,63 @@
+#include <ae/memory_range_initializer.h>
+#include <ae/runtime_error_code.h>
+#include <ae/runtime_error.h>
+#include <ae/memory_range.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// Требуемая гарантия: ae_runtime_error() возвращает слот ошибки текущего
+// потока, и код, записанный неудачным вызовом в одном потоке, виден только
+// этому потоку.
+//
+// Получаемая CMakeLists.txt версия ae этой гарантии пока не даёт: слот
+// общий для всех потоков, и тест падает. До перехода ae на thread_local
+// он отмечен в cmake/known_failures.cmake как ожидаемо падающий (WILL_FAIL);
+// когда ae получит слот на поток, ctest сообщит о неожиданном успехе,
+// и отметку нужно будет снять.
+TEST(ae_runtime_error, error_codes_are_thread_local) {
+  const int thread_count = 32;
+  const int iterations = 100000;
+
+  std::atomic<int> ready{0};
+  std::atomic<long> foreign_codes{0};
+  std::vector<std::thread> threads;
+
+  for (int t = 0; t < thread_count; ++t) {
+    threads.emplace_back([&, t]() {
+      char data[] = "ABCDEFGHI";
+      ae_memory_range_t range = ae_memory_range_initializer(data, data + 10);
+
+      // Чётные потоки выходят за границы диапазона, нечётные передают
+      // нулевой указатель: каждый должен видеть только свой код ошибки.
+      const bool out_of_range = t % 2 == 0;
+      const auto expected = out_of_range ? AE_RUNTIME_ERROR_OUT_OF_RANGE
+                                         : AE_RUNTIME_ERROR_NULL_POINTER;
+
+      // Все потоки начинают одновременно.
+      ++ready;
+      while (ready.load() < thread_count) {
+        std::this_thread::yield();
+      }
+
+      for (int i = 0; i < iterations; ++i) {
+        if (out_of_range) {
+          ae_memory_range_at_from_begin(&range, 10 + i % 16);
+        } else {
+          ae_memory_range_get_begin(nullptr);
+        }
+
+        if (ae_error_get_code_and_clear(ae_runtime_error()) != expected) {
+          ++foreign_codes;
+        }
+      }
+    });
+  }
+
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(foreign_codes.load(), 0);
+}
@@ -1,5 +1,85 @@
 #include <gtest/gtest.h>
 #include <ae/str_raw.h>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// Страница памяти, за которой следует недоступная страница: любое чтение
+// за концом первой страницы приводит к аварийному завершению теста.
+class guarded_page {
+public:
+  guarded_page() {
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    size_ = info.dwPageSize;
+    data_ = static_cast<ae_char_t *>(VirtualAlloc(
+        nullptr, 2 * size_, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
+    if (data_) {
+      DWORD old_protect;
+      guarded_ = VirtualProtect(data_ + size_, size_, PAGE_NOACCESS,
+                                &old_protect) != 0;
+    }
+#else
+    size_ = static_cast<ae_usize_t>(sysconf(_SC_PAGESIZE));
+    void *data = mmap(nullptr, 2 * size_, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    data_ = data == MAP_FAILED ? nullptr : static_cast<ae_char_t *>(data);
+    if (data_) {
+      guarded_ = mprotect(data_ + size_, size_, PROT_NONE) == 0;
+    }
+#endif
+  }
+
+  ~guarded_page() {
+#if defined(_WIN32)
+    VirtualFree(data_, 0, MEM_RELEASE);
+#else
+    munmap(data_, 2 * size_);
+#endif
+  }
+
+  guarded_page(const guarded_page &) = delete;
+  guarded_page &operator=(const guarded_page &) = delete;
+
+  ae_char_t *begin() const {
+    return data_;
+  }
+
+  ae_char_t *end() const {
+    return data_ + size_;
+  }
+
+  ae_usize_t size() const {
+    return size_;
+  }
+
+  // Установлена ли защита страницы, следующей за буфером.
+  bool guarded() const {
+    return guarded_;
+  }
+
+  // Размещает строку из `len` символов так, чтобы её нулевой
+  // терминатор был последним доступным байтом страницы.
+  ae_char_t *place_at_end(ae_usize_t len) const {
+    ae_char_t *str = end() - len - 1;
+    memset(str, 'x', len);
+    str[len] = '\0';
+    return str;
+  }
+
+private:
+  ae_char_t *data_;
+  ae_usize_t size_;
+  bool guarded_ = false;
+};
 
 TEST(ae_str_raw_find_char, find_existing_char_in_middle) {
   const char *str = "Hello, world!";
@@ -61,6 +141,47 @@ TEST(ae_str_raw_find_char, single_char_string_not_found) {
   EXPECT_EQ(result, nullptr);
 }
 
+TEST(ae_str_raw_find_char, beyond_length) {
+  const char str[] = "Hello\0World";
+  ae_usize_t len = 5;
+  ae_char_t value = 'W';
+  const ae_char_t * result = ae_str_raw_find_char(str, len, value);
+  EXPECT_EQ(result, nullptr);
+}
+
+TEST(ae_str_raw_find_char, find_null_char) {
+  const char str[] = "Hello\0";
+  ae_usize_t len = 6;
+  ae_char_t value = '\0';
+  const ae_char_t * result = ae_str_raw_find_char(str, len, value);
+  EXPECT_EQ(result, &str[5]);
+}
+
+TEST(ae_str_raw_find_char, every_tail_length_and_position) {
+  ae_char_t buffer[128 + 64 + 1];
+
+  for (ae_usize_t offset = 0; offset < 64; ++offset) {
+    const ae_char_t *str = buffer + offset;
+
+    for (ae_usize_t len = 0; len < 128; ++len) {
+      memset(buffer, 'a', sizeof(buffer));
+
+      // Искомый символ сразу за концом диапазона не должен находиться.
+      buffer[offset + len] = 'z';
+      ASSERT_EQ(ae_str_raw_find_char(str, len, 'z'), nullptr)
+          << "offset=" << offset << " len=" << len;
+
+      for (ae_usize_t position = 0; position < len; ++position) {
+        buffer[offset + position] = 'z';
+        ASSERT_EQ(ae_str_raw_find_char(str, len, 'z'), str + position)
+            << "offset=" << offset << " len=" << len
+            << " position=" << position;
+        buffer[offset + position] = 'a';
+      }
+    }
+  }
+}
+
 TEST(ae_str_raw_find_of_null_terminator, non_empty_string) {
   const char *str = "Hello, world!";
   const ae_char_t * result = ae_str_raw_find_of_null_terminator(str);
@@ -114,6 +235,47 @@ TEST(ae_str_raw_len, multiple_nulls) {
   EXPECT_EQ(result, 2);
 }
 
+TEST(ae_str_raw_find_of_null_terminator, no_overread_at_end_of_page) {
+  const guarded_page page;
+  ASSERT_NE(page.begin(), nullptr);
+  ASSERT_TRUE(page.guarded());
+
+  for (ae_usize_t len = 0; len < 256; ++len) {
+    const ae_char_t *str = page.place_at_end(len);
+    ASSERT_EQ(ae_str_raw_find_of_null_terminator(str), str + len)
+        << "len=" << len;
+  }
+
+  const ae_char_t *str = page.place_at_end(page.size() - 1);
+  EXPECT_EQ(ae_str_raw_find_of_null_terminator(str), page.end() - 1);
+}
+
+TEST(ae_str_raw_len, no_overread_at_end_of_page) {
+  const guarded_page page;
+  ASSERT_NE(page.begin(), nullptr);
+  ASSERT_TRUE(page.guarded());
+
+  for (ae_usize_t len = 0; len < 256; ++len) {
+    ASSERT_EQ(ae_str_raw_len(page.place_at_end(len)), len) << "len=" << len;
+  }
+
+  EXPECT_EQ(ae_str_raw_len(page.place_at_end(page.size() - 1)),
+            page.size() - 1);
+}
+
+TEST(ae_str_raw_len, every_length_and_misalignment) {
+  ae_char_t buffer[256 + 64];
+
+  for (ae_usize_t offset = 0; offset < 64; ++offset) {
+    for (ae_usize_t len = 0; len < 256; ++len) {
+      memset(buffer, 'x', sizeof(buffer));
+      buffer[offset + len] = '\0';
+      ASSERT_EQ(ae_str_raw_len(buffer + offset), len)
+          << "offset=" << offset << " len=" << len;
+    }
+  }
+}
+
 TEST(ae_str_raw_set_value, set_single_character) {
   ae_char_t buffer[1] = {'A'};
   ae_char_t value = 'Z';
@@ -167,6 +329,35 @@ TEST(ae_str_raw_set_value, set_special_characters) {
   EXPECT_EQ(buffer[1], '\n');
 }
 
+TEST(ae_str_raw_set_value, every_length_and_misalignment) {
+  ae_char_t buffer[256 + 2 * 64];
+
+  for (ae_usize_t offset = 0; offset < 64; ++offset) {
+    for (ae_usize_t len = 0; len <= 256; ++len) {
+      memset(buffer, '#', sizeof(buffer));
+      ae_str_raw_set_value(buffer + offset, len, ' ');
+
+      for (ae_usize_t i = 0; i < sizeof(buffer); ++i) {
+        const bool inside = i >= offset && i < offset + len;
+        ASSERT_EQ(buffer[i], inside ? ' ' : '#')
+            << "offset=" << offset << " len=" << len << " i=" << i;
+      }
+    }
+  }
+}
+
+TEST(ae_str_raw_set_value, large_buffer) {
+  // Больше кэша последнего уровня: путь с невременными записями.
+  std::vector<ae_char_t> buffer((ae_usize_t{64} << 20) + 64 + 1, '#');
+
+  ae_str_raw_set_value(&buffer[3], buffer.size() - 4, '\0');
+
+  EXPECT_EQ(buffer[2], '#');
+  EXPECT_EQ(std::count(buffer.begin() + 3, buffer.end() - 1, '\0'),
+            static_cast<std::ptrdiff_t>(buffer.size() - 4));
+  EXPECT_EQ(buffer.back(), '#');
+}
+
 TEST(ae_str_raw_copy, copy_equal_length) {
   ae_char_t src[] = {'A', 'B', 'C'};
   ae_char_t dst[3] = {0};
@@ -113,6 +113,43 @@ TEST(ae_wstr_raw_find_char, null_string) {
   EXPECT_EQ(result, nullptr);
 }
 
+TEST(ae_wstr_raw_find_char, every_tail_length_and_position) {
+  ae_wchar_t buffer[128 + 16 + 1];
+
+  for (ae_usize_t offset = 0; offset < 16; ++offset) {
+    const ae_wchar_t *str = buffer + offset;
+
+    for (ae_usize_t len = 0; len < 128; ++len) {
+      for (ae_wchar_t &value : buffer) {
+        value = L'a';
+      }
+
+      // Искомый символ сразу за концом диапазона не должен находиться.
+      buffer[offset + len] = L'\u306B';
+      ASSERT_EQ(ae_wstr_raw_find_char(str, len, L'\u306B'), nullptr)
+          << "offset=" << offset << " len=" << len;
+
+      for (ae_usize_t position = 0; position < len; ++position) {
+        buffer[offset + position] = L'\u306B';
+        ASSERT_EQ(ae_wstr_raw_find_char(str, len, L'\u306B'), str + position)
+            << "offset=" << offset << " len=" << len
+            << " position=" << position;
+        buffer[offset + position] = L'a';
+      }
+    }
+  }
+}
+
+TEST(ae_wstr_raw_find_char, ignores_partial_lane_matches) {
+  // Символы, совпадающие с искомым только в части байтов, не должны
+  // приниматься за вхождение при сравнении по байтам внутри векторов.
+  const ae_wchar_t str[] = {L'\u4100', L'\u4141', L'\u0141', L'A'};
+  ae_usize_t len = 4;
+  ae_wchar_t value = L'A';
+  const ae_wchar_t * result = ae_wstr_raw_find_char(str, len, value);
+  EXPECT_EQ(result, &str[3]);
+}
+
 TEST(ae_wstr_raw_find_of_null_terminator, empty_string) {
   const ae_wchar_t str[] = L"";
   const ae_wchar_t * result = ae_wstr_raw_find_of_null_terminator(str);
@@ -199,6 +236,25 @@ TEST(ae_wstr_raw_set_value, set_different_values) {
   EXPECT_EQ(buffer[1], L'@');
 }
 
+TEST(ae_wstr_raw_set_value, every_length_and_misalignment) {
+  ae_wchar_t buffer[256 + 2 * 16];
+
+  for (ae_usize_t offset = 0; offset < 16; ++offset) {
+    for (ae_usize_t len = 0; len <= 256; ++len) {
+      for (ae_wchar_t &value : buffer) {
+        value = L'#';
+      }
+      ae_wstr_raw_set_value(buffer + offset, len, L'\u3000');
+
+      for (ae_usize_t i = 0; i < sizeof(buffer) / sizeof(buffer[0]); ++i) {
+        const bool inside = i >= offset && i < offset + len;
+        ASSERT_EQ(buffer[i], inside ? L'\u3000' : L'#')
+            << "offset=" << offset << " len=" << len << " i=" << i;
+      }
+    }
+  }
+}
+
 TEST(ae_wstr_raw_copy, copy_equal_length) {
   ae_wchar_t src[] = {L'A', L'B', L'C'};
   ae_wchar_t dst[3] = {0};